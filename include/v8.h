@@ -1544,6 +1544,24 @@ class V8_EXPORT ScriptCompiler {
   static V8_WARN_UNUSED_RESULT MaybeLocal<Module> CompileModule(
       Isolate* isolate, Source* source);
 
+  /**
+   * This is an unfinished experimental feature, and is only exposed
+   * here for internal testing purposes. DO NOT USE.
+   *
+   * Compiles a batch of ES modules. The sources are parsed and compiled to
+   * bytecode concurrently on the platform's background threads, the calling
+   * thread helps out and then creates the Module objects in the order of
+   * |sources|. Since modules are only linked in Module::InstantiateModule,
+   * the order does not need to follow the import graph.
+   *
+   * On success, |modules| holds one Module per source. Otherwise the error of
+   * the first source that failed to compile is thrown, and |modules| is only
+   * filled up to that source.
+   */
+  static V8_WARN_UNUSED_RESULT Maybe<bool> CompileModules(
+      Isolate* isolate, size_t count, Source* const sources[],
+      Local<Module> modules[]);
+
   /**
    * Compile a function for a given context. This is equivalent to running
    *
@@ -6507,6 +6525,12 @@ class V8_EXPORT HeapStatistics {
    */
   size_t does_zap_garbage() { return does_zap_garbage_; }
 
+  /**
+   * Returns the total size of the bytecode that was dropped from functions
+   * which had not run for a while, see --flush-bytecode.
+   */
+  size_t flushed_bytecode_size() { return flushed_bytecode_size_; }
+
  private:
   size_t total_heap_size_;
   size_t total_heap_size_executable_;
@@ -6517,6 +6541,7 @@ class V8_EXPORT HeapStatistics {
   size_t malloced_memory_;
   size_t peak_malloced_memory_;
   bool does_zap_garbage_;
+  size_t flushed_bytecode_size_;
 
   friend class V8;
   friend class Isolate;
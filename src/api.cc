@@ -11,8 +11,10 @@
 #if defined(LEAK_SANITIZER)
 #include <sanitizer/lsan_interface.h>
 #endif            // defined(LEAK_SANITIZER)
+#include <algorithm>
 #include <cmath>  // For isnan.
 #include <limits>
+#include <memory>
 #include <vector>
 #include "include/v8-debug.h"
 #include "include/v8-profiler.h"
@@ -21,6 +23,7 @@
 #include "src/accessors.h"
 #include "src/api-natives.h"
 #include "src/assert-scope.h"
+#include "src/base/atomic-utils.h"
 #include "src/base/functional.h"
 #include "src/base/logging.h"
 #include "src/base/platform/platform.h"
@@ -2413,6 +2416,216 @@ MaybeLocal<Module> ScriptCompiler::CompileModule(Isolate* isolate,
   return ToApiHandle<Module>(i_isolate->factory()->NewModule(shared));
 }
 
+namespace {
+
+// Hands a copy of a source string to the streaming parser in one chunk, the
+// string itself cannot be read on a background thread.
+class OffHeapSourceStream : public ScriptCompiler::ExternalSourceStream {
+ public:
+  OffHeapSourceStream(uint8_t* data, size_t length)
+      : data_(data), length_(length) {}
+  ~OffHeapSourceStream() override { delete[] data_; }
+
+  size_t GetMoreData(const uint8_t** src) override {
+    // Ownership of the chunk passes to the caller.
+    size_t length = length_;
+    *src = data_;
+    data_ = nullptr;
+    length_ = 0;
+    return length;
+  }
+
+ private:
+  uint8_t* data_;
+  size_t length_;
+};
+
+i::StreamedSource* NewOffHeapStreamedSource(i::Handle<i::String> string) {
+  string = i::String::Flatten(string);
+  i::DisallowHeapAllocation no_allocation;
+  i::String::FlatContent content = string->GetFlatContent();
+  DCHECK(content.IsFlat());
+  size_t length = static_cast<size_t>(string->length());
+  if (content.IsOneByte()) {
+    uint8_t* data = new uint8_t[length];
+    i::CopyChars(data, content.ToOneByteVector().start(), length);
+    return new i::StreamedSource(new OffHeapSourceStream(data, length),
+                                 ScriptCompiler::StreamedSource::ONE_BYTE);
+  }
+  size_t size = length * sizeof(i::uc16);
+  uint8_t* data = new uint8_t[size];
+  i::MemCopy(data, content.ToUC16Vector().start(), size);
+  return new i::StreamedSource(new OffHeapSourceStream(data, size),
+                               ScriptCompiler::StreamedSource::TWO_BYTE);
+}
+
+// Creates the script for a source that was parsed, and possibly compiled, by
+// a BackgroundParsingTask and finishes its compilation. Returns an empty
+// handle with an exception pending if the source does not compile.
+i::MaybeHandle<i::SharedFunctionInfo> FinalizeStreamedSource(
+    i::Isolate* isolate, i::StreamedSource* source, i::Handle<i::String> str,
+    Local<Value> resource_name, Local<Integer> resource_line_offset,
+    Local<Integer> resource_column_offset, ScriptOriginOptions options,
+    Local<Value> source_map_url, Local<PrimitiveArray> host_defined_options) {
+  i::Handle<i::Script> script = isolate->factory()->NewScript(str);
+  if (!resource_name.IsEmpty()) {
+    script->set_name(*Utils::OpenHandle(*resource_name));
+  }
+  if (!host_defined_options.IsEmpty()) {
+    script->set_host_defined_options(*Utils::OpenHandle(*host_defined_options));
+  }
+  if (!resource_line_offset.IsEmpty()) {
+    script->set_line_offset(static_cast<int>(resource_line_offset->Value()));
+  }
+  if (!resource_column_offset.IsEmpty()) {
+    script->set_column_offset(
+        static_cast<int>(resource_column_offset->Value()));
+  }
+  script->set_origin_options(options);
+  if (!source_map_url.IsEmpty()) {
+    script->set_source_mapping_url(*Utils::OpenHandle(*source_map_url));
+  }
+
+  source->info->set_script(script);
+  if (source->info->literal() == nullptr) {
+    source->info->pending_error_handler()->ReportErrors(
+        isolate, script, source->info->ast_value_factory());
+  }
+  source->parser->UpdateStatistics(isolate, script);
+  source->info->UpdateStatisticsAfterBackgroundParse(isolate);
+  source->parser->HandleSourceURLComments(isolate, script);
+
+  i::MaybeHandle<i::SharedFunctionInfo> result;
+  if (source->info->literal() != nullptr) {
+    // Parsing has succeeded.
+    result = i::Compiler::GetSharedFunctionInfoForStreamedScript(
+        script, source, str->length());
+  }
+  source->Release();
+  return result;
+}
+
+// Runs the parsing tasks of a module batch on whichever threads call
+// RunTasks(). Shared with the posted background tasks, which can start after
+// the batch is complete and then find nothing left to do.
+class ModuleParsingState {
+ public:
+  explicit ModuleParsingState(
+      std::vector<ScriptCompiler::ScriptStreamingTask*> tasks)
+      : tasks_(std::move(tasks)), next_task_(0), tasks_done_(0) {}
+
+  void RunTasks() {
+    while (true) {
+      size_t index = next_task_.Increment(1) - 1;
+      if (index >= tasks_.size()) return;
+      tasks_[index]->Run();
+      tasks_done_.Signal();
+    }
+  }
+
+  void WaitForTasks() {
+    for (size_t i = 0; i < tasks_.size(); ++i) tasks_done_.Wait();
+  }
+
+ private:
+  const std::vector<ScriptCompiler::ScriptStreamingTask*> tasks_;
+  base::AtomicNumber<size_t> next_task_;
+  base::Semaphore tasks_done_;
+
+  DISALLOW_COPY_AND_ASSIGN(ModuleParsingState);
+};
+
+class ModuleParsingTask : public v8::Task {
+ public:
+  explicit ModuleParsingTask(std::shared_ptr<ModuleParsingState> state)
+      : state_(std::move(state)) {}
+
+  void Run() override { state_->RunTasks(); }
+
+ private:
+  std::shared_ptr<ModuleParsingState> state_;
+
+  DISALLOW_COPY_AND_ASSIGN(ModuleParsingTask);
+};
+
+}  // namespace
+
+Maybe<bool> ScriptCompiler::CompileModules(Isolate* v8_isolate, size_t count,
+                                           Source* const sources[],
+                                           Local<Module> modules[]) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  for (size_t i = 0; i < count; ++i) {
+    Utils::ApiCheck(sources[i]->GetResourceOptions().IsModule(),
+                    "v8::ScriptCompiler::CompileModules",
+                    "Invalid ScriptOrigin: is_module must be true");
+  }
+
+  if (!i::FLAG_script_streaming) {
+    for (size_t i = 0; i < count; ++i) {
+      if (!CompileModule(v8_isolate, sources[i]).ToLocal(&modules[i])) {
+        return Nothing<bool>();
+      }
+    }
+    return Just(true);
+  }
+  if (count == 0) return Just(true);
+
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"), "V8.CompileModules");
+  std::vector<std::unique_ptr<i::StreamedSource>> streamed_sources;
+  std::vector<std::unique_ptr<i::BackgroundParsingTask>> tasks;
+  {
+    i::HandleScope scope(isolate);
+    for (size_t i = 0; i < count; ++i) {
+      i::Handle<i::String> string =
+          Utils::OpenHandle(*(sources[i]->source_string));
+      streamed_sources.emplace_back(NewOffHeapStreamedSource(string));
+      streamed_sources.back()->is_module = true;
+      streamed_sources.back()->compile_on_background = true;
+      tasks.emplace_back(new i::BackgroundParsingTask(
+          streamed_sources.back().get(), kNoCompileOptions,
+          i::FLAG_stack_size, isolate));
+    }
+  }
+
+  // Parse and compile on the background threads, with this thread helping
+  // out until every source has been picked up.
+  {
+    std::vector<ScriptStreamingTask*> task_list;
+    for (auto& task : tasks) task_list.push_back(task.get());
+    auto state = std::make_shared<ModuleParsingState>(std::move(task_list));
+    v8::Platform* platform = i::V8::GetCurrentPlatform();
+    size_t num_threads = platform->NumberOfAvailableBackgroundThreads();
+    size_t num_background_tasks = std::min(count - 1, num_threads);
+    for (size_t i = 0; i < num_background_tasks; ++i) {
+      platform->CallOnBackgroundThread(new ModuleParsingTask(state),
+                                       v8::Platform::kShortRunningTask);
+    }
+    state->RunTasks();
+    state->WaitForTasks();
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    Source* source = sources[i];
+    ENTER_V8_NO_SCRIPT(isolate, v8_isolate->GetCurrentContext(),
+                       ScriptCompiler, CompileModules, Nothing<bool>(),
+                       InternalEscapableScope);
+    i::Handle<i::SharedFunctionInfo> shared;
+    has_pending_exception =
+        !FinalizeStreamedSource(
+             isolate, streamed_sources[i].get(),
+             Utils::OpenHandle(*(source->source_string)),
+             source->resource_name, source->resource_line_offset,
+             source->resource_column_offset, source->resource_options,
+             source->source_map_url, source->host_defined_options)
+             .ToHandle(&shared);
+    if (has_pending_exception) isolate->ReportPendingMessages();
+    RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+    modules[i] = handle_scope.Escape(
+        ToApiHandle<Module>(isolate->factory()->NewModule(shared)));
+  }
+  return Just(true);
+}
+
 
 class IsIdentifierHelper {
  public:
@@ -2585,50 +2798,16 @@ MaybeLocal<Script> ScriptCompiler::Compile(Local<Context> context,
                                            const ScriptOrigin& origin) {
   PREPARE_FOR_EXECUTION(context, ScriptCompiler, Compile, Script);
   TRACE_EVENT0("v8", "V8.ScriptCompiler");
-  i::StreamedSource* source = v8_source->impl();
-  i::Handle<i::String> str = Utils::OpenHandle(*(full_source_string));
-  i::Handle<i::Script> script = isolate->factory()->NewScript(str);
-  if (!origin.ResourceName().IsEmpty()) {
-    script->set_name(*Utils::OpenHandle(*(origin.ResourceName())));
-  }
-  if (!origin.HostDefinedOptions().IsEmpty()) {
-    script->set_host_defined_options(
-        *Utils::OpenHandle(*(origin.HostDefinedOptions())));
-  }
-  if (!origin.ResourceLineOffset().IsEmpty()) {
-    script->set_line_offset(
-        static_cast<int>(origin.ResourceLineOffset()->Value()));
-  }
-  if (!origin.ResourceColumnOffset().IsEmpty()) {
-    script->set_column_offset(
-        static_cast<int>(origin.ResourceColumnOffset()->Value()));
-  }
-  script->set_origin_options(origin.Options());
-  if (!origin.SourceMapUrl().IsEmpty()) {
-    script->set_source_mapping_url(
-        *Utils::OpenHandle(*(origin.SourceMapUrl())));
-  }
-
-  source->info->set_script(script);
-  if (source->info->literal() == nullptr) {
-    source->info->pending_error_handler()->ReportErrors(
-        isolate, script, source->info->ast_value_factory());
-  }
-  source->parser->UpdateStatistics(isolate, script);
-  source->info->UpdateStatisticsAfterBackgroundParse(isolate);
-  source->parser->HandleSourceURLComments(isolate, script);
-
   i::Handle<i::SharedFunctionInfo> result;
-  if (source->info->literal() != nullptr) {
-    // Parsing has succeeded.
-    result = i::Compiler::GetSharedFunctionInfoForStreamedScript(
-        script, source->info.get(), str->length());
-  }
-  has_pending_exception = result.is_null();
+  has_pending_exception =
+      !FinalizeStreamedSource(
+           isolate, v8_source->impl(), Utils::OpenHandle(*(full_source_string)),
+           origin.ResourceName(), origin.ResourceLineOffset(),
+           origin.ResourceColumnOffset(), origin.Options(),
+           origin.SourceMapUrl(), origin.HostDefinedOptions())
+           .ToHandle(&result);
   if (has_pending_exception) isolate->ReportPendingMessages();
 
-  source->Release();
-
   RETURN_ON_FAILED_EXECUTION(Script);
 
   Local<UnboundScript> generic = ToApiHandle<UnboundScript>(result);
@@ -6487,7 +6666,8 @@ HeapStatistics::HeapStatistics()
       heap_size_limit_(0),
       malloced_memory_(0),
       peak_malloced_memory_(0),
-      does_zap_garbage_(0) {}
+      does_zap_garbage_(0),
+      flushed_bytecode_size_(0) {}
 
 HeapSpaceStatistics::HeapSpaceStatistics(): space_name_(0),
                                             space_size_(0),
@@ -8833,6 +9013,7 @@ void Isolate::GetHeapStatistics(HeapStatistics* heap_statistics) {
   heap_statistics->peak_malloced_memory_ =
       isolate->allocator()->GetMaxMemoryUsage();
   heap_statistics->does_zap_garbage_ = heap->ShouldZapGarbage();
+  heap_statistics->flushed_bytecode_size_ = heap->flushed_bytecode_size();
 }
 
 
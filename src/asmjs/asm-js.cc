@@ -197,7 +197,11 @@ class AsmJsCompilationJob final : public CompilationJob {
         translate_time_(0),
         compile_time_(0) {}
 
+  void ReportDeferredFailure();
+
  protected:
+  void RecordHistograms(Isolate* isolate);
+
   Status PrepareJobImpl() final;
   Status ExecuteJobImpl() final;
   Status FinalizeJobImpl() final;
@@ -212,6 +216,15 @@ class AsmJsCompilationJob final : public CompilationJob {
   double translate_time_;  // Time (milliseconds) taken to execute step [1].
   double compile_time_;    // Time (milliseconds) taken to execute step [2].
 
+  // Samples taken during step [1]. Step [1] may run off the main thread, so
+  // they are only added to the isolate's counters by {RecordHistograms}.
+  int64_t translate_time_micro_ = 0;
+  size_t translate_zone_size_ = 0;
+
+  // Validation failure recorded while executing off the main thread.
+  int failure_location_ = kNoSourcePosition;
+  const char* failure_message_ = nullptr;
+
   DISALLOW_COPY_AND_ASSIGN(AsmJsCompilationJob);
 };
 
@@ -221,8 +234,6 @@ CompilationJob::Status AsmJsCompilationJob::PrepareJobImpl() {
 
 CompilationJob::Status AsmJsCompilationJob::ExecuteJobImpl() {
   // Step 1: Translate asm.js module to WebAssembly module.
-  HistogramTimerScope translate_time_scope(
-      compilation_info()->isolate()->counters()->asm_wasm_translation_time());
   size_t compile_zone_start = compilation_info()->zone()->allocation_size();
   base::ElapsedTimer translate_timer;
   translate_timer.Start();
@@ -240,6 +251,15 @@ CompilationJob::Status AsmJsCompilationJob::ExecuteJobImpl() {
   stream->Seek(compilation_info()->literal()->start_position());
   wasm::AsmJsParser parser(&translate_zone, stack_limit(), stream);
   if (!parser.Run()) {
+    translate_time_micro_ = translate_timer.Elapsed().InMicroseconds();
+    if (!ThreadId::Current().Equals(
+            compilation_info()->isolate()->thread_id())) {
+      // Messages can only be reported on the main thread, see
+      // {ReportDeferredFailure}.
+      failure_location_ = parser.failure_location();
+      failure_message_ = parser.failure_message();
+      return FAILED;
+    }
     // TODO(rmcilroy): Temporarily allow heap access here until we have a
     // mechanism for delaying pending messages.
     DCHECK(
@@ -249,6 +269,9 @@ CompilationJob::Status AsmJsCompilationJob::ExecuteJobImpl() {
     allow_deref.emplace();
 
     DCHECK(!compilation_info()->isolate()->has_pending_exception());
+    Counters* counters = compilation_info()->isolate()->counters();
+    counters->asm_wasm_translation_time()->AddSample(
+        static_cast<int>(translate_time_micro_));
     ReportCompilationFailure(parse_info()->script(), parser.failure_location(),
                              parser.failure_message());
     return FAILED;
@@ -261,40 +284,52 @@ CompilationJob::Status AsmJsCompilationJob::ExecuteJobImpl() {
 
   size_t compile_zone_size =
       compilation_info()->zone()->allocation_size() - compile_zone_start;
-  size_t translate_zone_size = translate_zone.allocation_size();
-  compilation_info()
-      ->isolate()
-      ->counters()
-      ->asm_wasm_translation_peak_memory_bytes()
-      ->AddSample(static_cast<int>(translate_zone_size));
+  translate_zone_size_ = translate_zone.allocation_size();
   translate_time_ = translate_timer.Elapsed().InMillisecondsF();
+  translate_time_micro_ = translate_timer.Elapsed().InMicroseconds();
+  if (FLAG_trace_asm_parser) {
+    PrintF(
+        "[asm.js translation successful: time=%0.3fms, "
+        "translate_zone=%" PRIuS "KB, compile_zone+=%" PRIuS "KB]\n",
+        translate_time_, translate_zone_size_ / KB, compile_zone_size / KB);
+  }
+  return SUCCEEDED;
+}
+
+void AsmJsCompilationJob::ReportDeferredFailure() {
+  DCHECK(
+      ThreadId::Current().Equals(compilation_info()->isolate()->thread_id()));
+  if (failure_message_ == nullptr) return;
+  Counters* counters = compilation_info()->isolate()->counters();
+  counters->asm_wasm_translation_time()->AddSample(
+      static_cast<int>(translate_time_micro_));
+  ReportCompilationFailure(parse_info()->script(), failure_location_,
+                           failure_message_);
+}
+
+void AsmJsCompilationJob::RecordHistograms(Isolate* isolate) {
+  Counters* counters = isolate->counters();
+  counters->asm_wasm_translation_time()->AddSample(
+      static_cast<int>(translate_time_micro_));
+  counters->asm_wasm_translation_peak_memory_bytes()->AddSample(
+      static_cast<int>(translate_zone_size_));
   int module_size = compilation_info()->literal()->end_position() -
                     compilation_info()->literal()->start_position();
-  compilation_info()->isolate()->counters()->asm_module_size_bytes()->AddSample(
-      module_size);
-  int64_t translation_time_micro = translate_timer.Elapsed().InMicroseconds();
+  counters->asm_module_size_bytes()->AddSample(module_size);
   // translation_throughput is not exact (assumes MB == 1000000). But that is ok
   // since the metric is stored in buckets that lose some precision anyways.
   int translation_throughput =
-      translation_time_micro != 0
+      translate_time_micro_ != 0
           ? static_cast<int>(static_cast<int64_t>(module_size) /
-                             translation_time_micro)
+                             translate_time_micro_)
           : 0;
-  compilation_info()
-      ->isolate()
-      ->counters()
-      ->asm_wasm_translation_throughput()
-      ->AddSample(translation_throughput);
-  if (FLAG_trace_asm_parser) {
-    PrintF(
-        "[asm.js translation successful: time=%0.3fms, "
-        "translate_zone=%" PRIuS "KB, compile_zone+=%" PRIuS "KB]\n",
-        translate_time_, translate_zone_size / KB, compile_zone_size / KB);
-  }
-  return SUCCEEDED;
+  counters->asm_wasm_translation_throughput()->AddSample(
+      translation_throughput);
 }
 
 CompilationJob::Status AsmJsCompilationJob::FinalizeJobImpl() {
+  RecordHistograms(compilation_info()->isolate());
+
   // Step 2: Compile and decode the WebAssembly module.
   base::ElapsedTimer compile_timer;
   compile_timer.Start();
@@ -336,6 +371,10 @@ CompilationJob* AsmJs::NewCompilationJob(ParseInfo* parse_info,
   return new AsmJsCompilationJob(parse_info, literal, isolate);
 }
 
+void AsmJs::ReportDeferredFailure(CompilationJob* job) {
+  static_cast<AsmJsCompilationJob*>(job)->ReportDeferredFailure();
+}
+
 MaybeHandle<Object> AsmJs::InstantiateAsmWasm(Isolate* isolate,
                                               Handle<SharedFunctionInfo> shared,
                                               Handle<FixedArray> wasm_data,
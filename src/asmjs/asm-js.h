@@ -32,6 +32,10 @@ class AsmJs {
                                                 Handle<JSReceiver> foreign,
                                                 Handle<JSArrayBuffer> memory);
 
+  // Reports the validation failure of an asm.js compilation {job} which was
+  // executed off the main thread. Must be called on the main thread.
+  static void ReportDeferredFailure(CompilationJob* job);
+
   // Special export name used to indicate that the module exports a single
   // function instead of a JavaScript object holding multiple functions.
   static const char* const kSingleFunctionName;
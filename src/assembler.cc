@@ -986,6 +986,16 @@ ExternalReference ExternalReference::wasm_float64_pow(Isolate* isolate) {
       Redirect(isolate, FUNCTION_ADDR(wasm::float64_pow_wrapper)));
 }
 
+ExternalReference ExternalReference::wasm_memory_copy(Isolate* isolate) {
+  return ExternalReference(
+      Redirect(isolate, FUNCTION_ADDR(wasm::memory_copy_wrapper)));
+}
+
+ExternalReference ExternalReference::wasm_memory_fill(Isolate* isolate) {
+  return ExternalReference(
+      Redirect(isolate, FUNCTION_ADDR(wasm::memory_fill_wrapper)));
+}
+
 ExternalReference ExternalReference::wasm_set_thread_in_wasm_flag(
     Isolate* isolate) {
   return ExternalReference(
@@ -2256,6 +2256,17 @@ class FunctionLiteral final : public Expression {
   bool ShouldEagerCompile() const;
   void SetShouldEagerCompile();
 
+  // Set on lazily compiled functions which are nevertheless likely to be
+  // called soon, e.g. top-level function declarations that are also called
+  // from the top-level code. With --predictive-compile such functions are
+  // compiled speculatively on the compiler dispatcher.
+  bool should_compile_in_background() const {
+    return ShouldCompileInBackground::decode(bit_field_);
+  }
+  void set_should_compile_in_background() {
+    bit_field_ = ShouldCompileInBackground::update(bit_field_, true);
+  }
+
   FunctionType function_type() const {
     return FunctionTypeBits::decode(bit_field_);
   }
@@ -2317,7 +2328,8 @@ class FunctionLiteral final : public Expression {
                   Pretenure::encode(false) |
                   HasDuplicateParameters::encode(has_duplicate_parameters ==
                                                  kHasDuplicateParameters) |
-                  DontOptimizeReasonField::encode(kNoReason);
+                  DontOptimizeReasonField::encode(kNoReason) |
+                  ShouldCompileInBackground::encode(false);
     if (eager_compile_hint == kShouldEagerCompile) SetShouldEagerCompile();
     DCHECK_EQ(body == nullptr, expected_property_count < 0);
   }
@@ -2328,6 +2340,8 @@ class FunctionLiteral final : public Expression {
   class HasDuplicateParameters : public BitField<bool, Pretenure::kNext, 1> {};
   class DontOptimizeReasonField
       : public BitField<BailoutReason, HasDuplicateParameters::kNext, 8> {};
+  class ShouldCompileInBackground
+      : public BitField<bool, DontOptimizeReasonField::kNext, 1> {};
 
   int expected_property_count_;
   int parameter_count_;
@@ -36,6 +36,13 @@ CompilationInfo::CompilationInfo(Zone* zone, Isolate* isolate,
   if (parse_info->is_native()) MarkAsNative();
   if (parse_info->will_serialize()) MarkAsSerializing();
   if (parse_info->collect_type_profile()) MarkAsCollectTypeProfile();
+  // Top-level code cannot be reparsed on its own, it always gets positions.
+  if (FLAG_enable_lazy_source_positions && !is_native() &&
+      literal->function_literal_id() != FunctionLiteral::kIdTypeTopLevel &&
+      !parse_info->collect_source_positions() &&
+      !isolate->NeedsSourcePositionsForProfiling()) {
+    MarkAsLazySourcePositions();
+  }
 }
 
 CompilationInfo::CompilationInfo(Zone* zone, Isolate* isolate,
@@ -171,8 +178,9 @@ int CompilationInfo::GetDeclareGlobalsFlags() const {
 
 SourcePositionTableBuilder::RecordingMode
 CompilationInfo::SourcePositionRecordingMode() const {
-  return is_native() ? SourcePositionTableBuilder::OMIT_SOURCE_POSITIONS
-                     : SourcePositionTableBuilder::RECORD_SOURCE_POSITIONS;
+  return is_native() || has_lazy_source_positions()
+             ? SourcePositionTableBuilder::OMIT_SOURCE_POSITIONS
+             : SourcePositionTableBuilder::RECORD_SOURCE_POSITIONS;
 }
 
 bool CompilationInfo::has_context() const { return !closure().is_null(); }
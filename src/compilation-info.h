@@ -49,6 +49,7 @@ class V8_EXPORT_PRIVATE CompilationInfo final {
     kSourcePositionsEnabled = 1 << 9,
     kBailoutOnUninitialized = 1 << 10,
     kLoopPeelingEnabled = 1 << 11,
+    kLazySourcePositions = 1 << 12,
   };
 
   // Construct a compilation info for unoptimized compilation.
@@ -140,7 +141,15 @@ class V8_EXPORT_PRIVATE CompilationInfo final {
     return GetFlag(kSourcePositionsEnabled);
   }
 
+  // Bytecode is generated without a source position table, which is collected
+  // later by Compiler::CollectSourcePositions if needed.
+  void MarkAsLazySourcePositions() { SetFlag(kLazySourcePositions); }
+  bool has_lazy_source_positions() const {
+    return GetFlag(kLazySourcePositions);
+  }
+
   void MarkAsInliningEnabled() { SetFlag(kInliningEnabled); }
+  void MarkAsInliningDisabled() { SetFlag(kInliningEnabled, false); }
   bool is_inlining_enabled() const { return GetFlag(kInliningEnabled); }
 
   void MarkAsSplittingEnabled() { SetFlag(kSplittingEnabled); }
@@ -50,6 +50,13 @@ void CompilationStatistics::RecordTotalStats(size_t source_size,
 }
 
 
+void CompilationStatistics::RecordMoveStats(const MoveStats& stats) {
+  base::LockGuard<base::Mutex> guard(&record_mutex_);
+
+  move_stats_.Accumulate(stats);
+}
+
+
 void CompilationStatistics::BasicStats::Accumulate(const BasicStats& stats) {
   delta_ += stats.delta_;
   total_allocated_bytes_ += stats.total_allocated_bytes_;
@@ -60,6 +67,19 @@ void CompilationStatistics::BasicStats::Accumulate(const BasicStats& stats) {
   }
 }
 
+void CompilationStatistics::MoveStats::Accumulate(const MoveStats& stats) {
+  moves_ += stats.moves_;
+  spills_ += stats.spills_;
+  reloads_ += stats.reloads_;
+  loop_spills_ += stats.loop_spills_;
+  loop_reloads_ += stats.loop_reloads_;
+  size_t loop_traffic = stats.loop_spills_ + stats.loop_reloads_;
+  if (loop_traffic > max_loop_traffic_) {
+    max_loop_traffic_ = loop_traffic;
+    function_name_ = stats.function_name_;
+  }
+}
+
 static void WriteLine(std::ostream& os, bool machine_format, const char* name,
                       const CompilationStatistics::BasicStats& stats,
                       const CompilationStatistics::BasicStats& total_stats) {
@@ -113,6 +133,43 @@ static void WritePhaseKindBreak(std::ostream& os) {
         "--------------------------------------------------------\n";
 }
 
+
+static void WriteMoveStats(std::ostream& os, bool machine_format,
+                           const CompilationStatistics::MoveStats& stats) {
+  const size_t kBufferSize = 256;
+  char buffer[kBufferSize];
+
+  if (machine_format) {
+    base::OS::SNPrintF(buffer, kBufferSize,
+                       "\n\"regalloc_moves\"=%" PRIuS
+                       "\n\"regalloc_spills\"=%" PRIuS
+                       "\n\"regalloc_reloads\"=%" PRIuS
+                       "\n\"regalloc_loop_spills\"=%" PRIuS
+                       "\n\"regalloc_loop_reloads\"=%" PRIuS,
+                       stats.moves_, stats.spills_, stats.reloads_,
+                       stats.loop_spills_, stats.loop_reloads_);
+    os << buffer;
+  } else {
+    os << "\n";
+    WriteFullLine(os);
+    os << "        Register allocation         Moves     Spills    Reloads"
+       << "   Loop spills  Loop reloads\n";
+    WriteFullLine(os);
+    base::OS::SNPrintF(buffer, kBufferSize,
+                       "%28s %10" PRIuS " %10" PRIuS " %10" PRIuS " %13" PRIuS
+                       " %13" PRIuS,
+                       "totals", stats.moves_, stats.spills_, stats.reloads_,
+                       stats.loop_spills_, stats.loop_reloads_);
+    os << buffer << std::endl;
+    if (stats.function_name_.size() > 0) {
+      base::OS::SNPrintF(buffer, kBufferSize,
+                         "%28s %10" PRIuS " spills and reloads in loops",
+                         "max. per function", stats.max_loop_traffic_);
+      os << buffer << "   " << stats.function_name_.c_str() << std::endl;
+    }
+  }
+}
+
 std::ostream& operator<<(std::ostream& os, const AsPrintableStatistics& ps) {
   // phase_kind_map_ and phase_map_ don't get mutated, so store a bunch of
   // pointers into them.
@@ -154,6 +211,7 @@ std::ostream& operator<<(std::ostream& os, const AsPrintableStatistics& ps) {
 
   if (!ps.machine_output) WriteFullLine(os);
   WriteLine(os, ps.machine_output, "totals", s.total_stats_, s.total_stats_);
+  WriteMoveStats(os, ps.machine_output, s.move_stats_);
 
   return os;
 }
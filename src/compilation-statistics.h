@@ -50,6 +50,32 @@ class CompilationStatistics final : public Malloced {
 
   void RecordTotalStats(size_t source_size, const BasicStats& stats);
 
+  // Gap move statistics gathered after register allocation. Spills are moves
+  // from a register to a stack slot, reloads are moves from a stack slot to a
+  // register; the loop counters only include moves in blocks inside a loop.
+  class MoveStats {
+   public:
+    MoveStats()
+        : moves_(0),
+          spills_(0),
+          reloads_(0),
+          loop_spills_(0),
+          loop_reloads_(0),
+          max_loop_traffic_(0) {}
+
+    void Accumulate(const MoveStats& stats);
+
+    size_t moves_;
+    size_t spills_;
+    size_t reloads_;
+    size_t loop_spills_;
+    size_t loop_reloads_;
+    size_t max_loop_traffic_;
+    std::string function_name_;
+  };
+
+  void RecordMoveStats(const MoveStats& stats);
+
  private:
   class TotalStats : public BasicStats {
    public:
@@ -78,6 +104,7 @@ class CompilationStatistics final : public Malloced {
   typedef std::map<std::string, PhaseStats> PhaseMap;
 
   TotalStats total_stats_;
+  MoveStats move_stats_;
   PhaseKindMap phase_kind_map_;
   PhaseMap phase_map_;
   base::Mutex record_mutex_;
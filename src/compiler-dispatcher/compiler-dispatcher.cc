@@ -164,6 +164,10 @@ CompilerDispatcher::CompilerDispatcher(Isolate* isolate, Platform* platform,
       next_job_id_(0),
       shared_to_unoptimized_job_id_(isolate->heap()),
       memory_pressure_level_(MemoryPressureLevel::kNone),
+      num_predicted_jobs_(0),
+      num_predicted_ready_(0),
+      num_predicted_on_demand_(0),
+      num_predicted_wasted_(0),
       abort_(false),
       idle_task_scheduled_(false),
       num_background_tasks_(0),
@@ -179,6 +183,9 @@ CompilerDispatcher::~CompilerDispatcher() {
   // To avoid crashing in unit tests due to unfished jobs.
   AbortAll(BlockingBehavior::kBlock);
   task_manager_->CancelAndWait();
+  if (trace_compiler_dispatcher_ && num_predicted_jobs_ > 0) {
+    PrintPredictionStatistics();
+  }
 }
 
 bool CompilerDispatcher::CanEnqueue() {
@@ -271,6 +278,28 @@ bool CompilerDispatcher::EnqueueAndStep(Handle<SharedFunctionInfo> function) {
   return true;
 }
 
+bool CompilerDispatcher::EnqueuePredicted(
+    Handle<SharedFunctionInfo> function) {
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "V8.CompilerDispatcherEnqueuePredicted");
+  if (!CanEnqueue(function)) return false;
+  if (IsEnqueued(function)) return true;
+
+  if (trace_compiler_dispatcher_) {
+    PrintF("CompilerDispatcher: enqueuing ");
+    function->ShortPrint();
+    PrintF(" for predictive parse and compile\n");
+  }
+
+  std::unique_ptr<CompilerDispatcherJob> job(new UnoptimizedCompileJob(
+      isolate_, tracer_.get(), function, max_stack_size_));
+  predicted_jobs_.insert(job.get());
+  num_predicted_jobs_++;
+  isolate_->counters()->compiler_dispatcher_predicted_jobs()->Increment();
+  EnqueueAndStep(std::move(job));
+  return true;
+}
+
 bool CompilerDispatcher::IsEnabled() const { return FLAG_compiler_dispatcher; }
 
 bool CompilerDispatcher::IsEnqueued(Handle<SharedFunctionInfo> function) const {
@@ -317,6 +346,12 @@ bool CompilerDispatcher::FinishNow(Handle<SharedFunctionInfo> function) {
                "V8.CompilerDispatcherFinishNow");
   JobMap::const_iterator job = GetJobFor(function);
   CHECK(job != jobs_.end());
+  if (predicted_jobs_.erase(job->second.get())) {
+    // The function was needed before the dispatcher got to finish it.
+    num_predicted_on_demand_++;
+    isolate_->counters()->compiler_dispatcher_predicted_on_demand()
+        ->Increment();
+  }
   bool result = FinishNow(job->second.get());
   RemoveIfFinished(job);
   return result;
@@ -360,6 +395,7 @@ void CompilerDispatcher::AbortAll(BlockingBehavior blocking) {
         it.second->ShortPrintOnMainThread();
         PrintF("\n");
       }
+      RecordPredictedJobRemoved(it.second.get());
       it.second->ResetOnMainThread(isolate_);
     }
     jobs_.clear();
@@ -678,9 +714,30 @@ CompilerDispatcher::JobMap::const_iterator CompilerDispatcher::InsertJob(
   return it;
 }
 
+void CompilerDispatcher::RecordPredictedJobRemoved(CompilerDispatcherJob* job) {
+  if (predicted_jobs_.erase(job) == 0) return;
+  if (job->IsFinished() && !job->IsFailed()) {
+    num_predicted_ready_++;
+    isolate_->counters()->compiler_dispatcher_predicted_ready()->Increment();
+  } else {
+    num_predicted_wasted_++;
+    isolate_->counters()->compiler_dispatcher_predicted_wasted()->Increment();
+  }
+}
+
+void CompilerDispatcher::PrintPredictionStatistics() const {
+  double hit_rate = 100.0 * num_predicted_ready_ / num_predicted_jobs_;
+  PrintF(
+      "CompilerDispatcher: predicted %zu functions, %zu ready before first "
+      "call (%.1f%%), %zu finished on demand, %zu wasted\n",
+      num_predicted_jobs_, num_predicted_ready_, hit_rate,
+      num_predicted_on_demand_, num_predicted_wasted_);
+}
+
 CompilerDispatcher::JobMap::const_iterator CompilerDispatcher::RemoveJob(
     CompilerDispatcher::JobMap::const_iterator it) {
   CompilerDispatcherJob* job = it->second.get();
+  RecordPredictedJobRemoved(job);
   job->ResetOnMainThread(isolate_);
 
   // Unmaps unoptimized jobs' SFIs to their job id.
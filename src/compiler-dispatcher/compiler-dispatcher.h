@@ -89,6 +89,11 @@ class V8_EXPORT_PRIVATE CompilerDispatcher {
   // true if the job was enqueued.
   bool EnqueueAndStep(Handle<SharedFunctionInfo> function);
 
+  // Like EnqueueAndStep, but for functions that the parser predicted to be
+  // called soon. These jobs are accounted separately, so that the hit rate of
+  // the prediction can be traced with --trace-compiler-dispatcher.
+  bool EnqueuePredicted(Handle<SharedFunctionInfo> function);
+
   // Returns true if there is a pending job for the given function.
   bool IsEnqueued(Handle<SharedFunctionInfo> function) const;
 
@@ -124,6 +129,11 @@ class V8_EXPORT_PRIVATE CompilerDispatcher {
   FRIEND_TEST(CompilerDispatcherTest, AsyncAbortAllRunningBackgroundTask);
   FRIEND_TEST(CompilerDispatcherTest, FinishNowDuringAbortAll);
   FRIEND_TEST(CompilerDispatcherTest, CompileMultipleOnBackgroundThread);
+  FRIEND_TEST(CompilerDispatcherTest, CompileAsmJsOnBackgroundThread);
+  FRIEND_TEST(CompilerDispatcherTest, CompileInvalidAsmJsOnBackgroundThread);
+  FRIEND_TEST(CompilerDispatcherTest, EnqueuePredictedFinishNow);
+  FRIEND_TEST(CompilerDispatcherTest, EnqueuePredictedIdleTask);
+  FRIEND_TEST(CompilerDispatcherTest, EnqueuePredictedAbortAll);
 
   typedef std::map<JobId, std::unique_ptr<CompilerDispatcherJob>> JobMap;
   typedef IdentityMap<JobId, FreeStoreAllocationPolicy> SharedToJobIdMap;
@@ -152,6 +162,8 @@ class V8_EXPORT_PRIVATE CompilerDispatcher {
   // Returns iterator following the removed job.
   JobMap::const_iterator RemoveJob(JobMap::const_iterator job);
   bool FinishNow(CompilerDispatcherJob* job);
+  void RecordPredictedJobRemoved(CompilerDispatcherJob* job);
+  void PrintPredictionStatistics() const;
 
   Isolate* isolate_;
   Platform* platform_;
@@ -176,6 +188,16 @@ class V8_EXPORT_PRIVATE CompilerDispatcher {
 
   base::AtomicValue<v8::MemoryPressureLevel> memory_pressure_level_;
 
+  // The set of jobs enqueued via EnqueuePredicted which are still in jobs_.
+  std::unordered_set<CompilerDispatcherJob*> predicted_jobs_;
+
+  // Outcome of predicted jobs: finished before the function was needed,
+  // finished on demand by FinishNow, or aborted / failed (wasted).
+  size_t num_predicted_jobs_;
+  size_t num_predicted_ready_;
+  size_t num_predicted_on_demand_;
+  size_t num_predicted_wasted_;
+
   // The following members can be accessed from any thread. Methods need to hold
   // the mutex |mutex_| while accessing them.
   base::Mutex mutex_;
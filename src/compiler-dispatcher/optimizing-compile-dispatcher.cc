@@ -211,6 +211,21 @@ void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
   }
 }
 
+bool OptimizingCompileDispatcher::HasJobs() {
+  {
+    base::LockGuard<base::Mutex> access_input_queue(&input_queue_mutex_);
+    if (input_queue_length_ > 0 || blocked_jobs_ > 0) return true;
+  }
+  {
+    // Jobs taken off the input queue are being compiled until their task
+    // drops its reference.
+    base::LockGuard<base::Mutex> lock_guard(&ref_count_mutex_);
+    if (ref_count_ > 0) return true;
+  }
+  base::LockGuard<base::Mutex> access_output_queue(&output_queue_mutex_);
+  return !output_queue_.empty();
+}
+
 void OptimizingCompileDispatcher::QueueForOptimization(CompilationJob* job) {
   DCHECK(IsQueueAvailable());
   {
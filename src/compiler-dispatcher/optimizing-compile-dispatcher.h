@@ -45,6 +45,8 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   void QueueForOptimization(CompilationJob* job);
   void Unblock();
   void InstallOptimizedFunctions();
+  // Returns true if there are jobs that have not been installed yet.
+  bool HasJobs();
 
   inline bool IsQueueAvailable() {
     base::LockGuard<base::Mutex> access_input_queue(&input_queue_mutex_);
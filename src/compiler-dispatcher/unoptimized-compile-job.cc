@@ -409,8 +409,15 @@ void UnoptimizedCompileJob::FinalizeCompilingOnMainThread(Isolate* isolate) {
     // Allocate scope infos for the literal.
     DeclarationScope::AllocateScopeInfos(parse_info_.get(), isolate,
                                          AnalyzeMode::kRegular);
-    compilation_job_->compilation_info()->set_shared_info(shared_);
-    if (compilation_job_->state() == CompilationJob::State::kFailed ||
+    if (compilation_job_->state() == CompilationJob::State::kFailed) {
+      // asm.js modules which failed validation are compiled to bytecode.
+      compilation_job_.reset(
+          Compiler::ReplaceFailedAsmJsJob(compilation_job_.get(), isolate));
+    }
+    if (compilation_job_) {
+      compilation_job_->compilation_info()->set_shared_info(shared_);
+    }
+    if (!compilation_job_ ||
         !Compiler::FinalizeCompilationJob(compilation_job_.release())) {
       if (!isolate->has_pending_exception()) isolate->StackOverflow();
       status_ = Status::kFailed;
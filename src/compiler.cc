@@ -30,12 +30,15 @@
 #include "src/log-inl.h"
 #include "src/messages.h"
 #include "src/objects/map.h"
+#include "src/parsing/background-parsing-task.h"
 #include "src/parsing/parse-info.h"
+#include "src/parsing/parser.h"
 #include "src/parsing/parsing.h"
 #include "src/parsing/rewriter.h"
 #include "src/parsing/scanner-character-streams.h"
 #include "src/runtime-profiler.h"
 #include "src/snapshot/code-serializer.h"
+#include "src/source-position-table.h"
 #include "src/vm-state-inl.h"
 
 namespace v8 {
@@ -81,9 +84,15 @@ CompilationJob::CompilationJob(uintptr_t stack_limit, ParseInfo* parse_info,
       stack_limit_(stack_limit) {}
 
 CompilationJob::Status CompilationJob::PrepareJob() {
-  DCHECK(
-      ThreadId::Current().Equals(compilation_info()->isolate()->thread_id()));
-  DisallowJavascriptExecution no_js(compilation_info()->isolate());
+  Isolate* isolate = compilation_info()->isolate();
+  // Unoptimized jobs for streamed scripts are prepared on the background
+  // thread that parsed them, which cannot execute JavaScript anyway.
+  base::Optional<DisallowJavascriptExecution> no_js;
+  if (ThreadId::Current().Equals(isolate->thread_id())) {
+    no_js.emplace(isolate);
+  } else {
+    DCHECK(!compilation_info()->IsOptimizing());
+  }
 
   if (FLAG_trace_opt && compilation_info()->IsOptimizing()) {
     OFStream os(stdout);
@@ -275,6 +284,8 @@ void InstallUnoptimizedCode(CompilationInfo* compilation_info) {
     DCHECK(!shared->HasBytecodeArray());  // Only compiled once.
     DCHECK(!compilation_info->has_asm_wasm_data());
     shared->set_bytecode_array(*compilation_info->bytecode_array());
+    shared->set_has_lazy_source_positions(
+        compilation_info->has_lazy_source_positions());
   } else if (compilation_info->has_asm_wasm_data()) {
     shared->set_asm_wasm_data(*compilation_info->asm_wasm_data());
   }
@@ -347,8 +358,12 @@ bool Renumber(ParseInfo* parse_info,
                                 parse_info->literal(), eager_literals);
 }
 
+// If asm.js validation fails off the main thread, the failed asm.js job is
+// added to {failed_asm_jobs}, so that the failure can be reported once the
+// compilation is finalized on the main thread.
 std::unique_ptr<CompilationJob> PrepareAndExecuteUnoptimizedCompileJob(
-    ParseInfo* parse_info, FunctionLiteral* literal, Isolate* isolate) {
+    ParseInfo* parse_info, FunctionLiteral* literal, Isolate* isolate,
+    CompilationJobList* failed_asm_jobs) {
   if (UseAsmWasm(literal, parse_info->is_asm_wasm_broken())) {
     std::unique_ptr<CompilationJob> asm_job(
         AsmJs::NewCompilationJob(parse_info, literal, isolate));
@@ -356,6 +371,10 @@ std::unique_ptr<CompilationJob> PrepareAndExecuteUnoptimizedCompileJob(
         asm_job->ExecuteJob() == CompilationJob::SUCCEEDED) {
       return asm_job;
     }
+    if (!ThreadId::Current().Equals(isolate->thread_id())) {
+      DCHECK_NOT_NULL(failed_asm_jobs);
+      failed_asm_jobs->emplace_front(std::move(asm_job));
+    }
     // asm.js validation failed, fall through to standard unoptimized compile.
     // Note: we rely on the fact that AsmJs jobs have done all validation in the
     // PrepareJob and ExecuteJob phases and can't fail in FinalizeJob with
@@ -375,7 +394,8 @@ std::unique_ptr<CompilationJob> PrepareAndExecuteUnoptimizedCompileJob(
 // TODO(rmcilroy): Remove |isolate| once CompilationJob doesn't need it.
 std::unique_ptr<CompilationJob> GenerateUnoptimizedCode(
     ParseInfo* parse_info, Isolate* isolate,
-    std::forward_list<std::unique_ptr<CompilationJob>>* inner_function_jobs) {
+    std::forward_list<std::unique_ptr<CompilationJob>>* inner_function_jobs,
+    CompilationJobList* failed_asm_jobs = nullptr) {
   DisallowHeapAllocation no_allocation;
   DisallowHandleAllocation no_handles;
   DisallowHandleDereference no_deref;
@@ -392,15 +412,20 @@ std::unique_ptr<CompilationJob> GenerateUnoptimizedCode(
   // Prepare and execute compilation of the outer-most function.
   std::unique_ptr<CompilationJob> outer_function_job(
       PrepareAndExecuteUnoptimizedCompileJob(parse_info, parse_info->literal(),
-                                             isolate));
+                                             isolate, failed_asm_jobs));
   if (!outer_function_job) return std::unique_ptr<CompilationJob>();
 
   // Prepare and execute compilation jobs for eager inner functions.
   for (auto it : inner_literals) {
     FunctionLiteral* inner_literal = it->value();
+    // asm.js modules are left to the compiler dispatcher, see
+    // {Compiler::GetSharedFunctionInfo}.
+    if (FLAG_concurrent_asm_translation && UseAsmWasm(inner_literal, false)) {
+      continue;
+    }
     std::unique_ptr<CompilationJob> inner_job(
         PrepareAndExecuteUnoptimizedCompileJob(parse_info, inner_literal,
-                                               isolate));
+                                               isolate, failed_asm_jobs));
     if (!inner_job) return std::unique_ptr<CompilationJob>();
     inner_function_jobs->emplace_front(std::move(inner_job));
   }
@@ -513,9 +538,11 @@ bool GetOptimizedCodeNow(CompilationJob* job) {
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                "V8.RecompileSynchronous");
 
-  if (job->PrepareJob() != CompilationJob::SUCCEEDED ||
-      job->ExecuteJob() != CompilationJob::SUCCEEDED ||
-      job->FinalizeJob() != CompilationJob::SUCCEEDED) {
+  bool succeeded = job->PrepareJob() == CompilationJob::SUCCEEDED &&
+                   job->ExecuteJob() == CompilationJob::SUCCEEDED &&
+                   job->FinalizeJob() == CompilationJob::SUCCEEDED;
+  job->ReportCounters();
+  if (!succeeded) {
     if (FLAG_trace_opt) {
       PrintF("[aborted optimizing ");
       compilation_info->closure()->ShortPrint();
@@ -562,7 +589,10 @@ bool GetOptimizedCodeLater(CompilationJob* job) {
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                "V8.RecompileSynchronous");
 
-  if (job->PrepareJob() != CompilationJob::SUCCEEDED) return false;
+  if (job->PrepareJob() != CompilationJob::SUCCEEDED) {
+    job->ReportCounters();
+    return false;
+  }
   isolate->optimizing_compile_dispatcher()->QueueForOptimization(job);
 
   if (FLAG_trace_concurrent_recompilation) {
@@ -694,6 +724,10 @@ CompilationJob::Status FinalizeOptimizedCompilationJob(CompilationJob* job) {
 
   DCHECK(!shared->HasBreakInfo());
 
+  // Report what the job gathered so far, also if it failed on the
+  // concurrent thread and will not be finalized.
+  job->ReportCounters();
+
   // 1) Optimization on the concurrent thread may have failed.
   // 2) The function may have already been optimized by OSR.  Simply continue.
   //    Except when OSR already disabled optimization for some reason.
@@ -734,6 +768,44 @@ CompilationJob::Status FinalizeOptimizedCompilationJob(CompilationJob* job) {
   return CompilationJob::FAILED;
 }
 
+// Allocates the heap objects for compiled top-level code and its eager inner
+// functions.
+MaybeHandle<SharedFunctionInfo> FinalizeTopLevel(
+    ParseInfo* parse_info, Isolate* isolate, CompilationJob* outer_function_job,
+    std::forward_list<std::unique_ptr<CompilationJob>>* inner_function_jobs) {
+  if (outer_function_job == nullptr) {
+    if (!isolate->has_pending_exception()) isolate->StackOverflow();
+    return MaybeHandle<SharedFunctionInfo>();
+  }
+  Handle<Script> script = parse_info->script();
+
+  // Internalize ast values onto the heap.
+  parse_info->ast_value_factory()->Internalize(isolate);
+
+  // Create shared function infos for top level and shared function infos array
+  // for inner functions.
+  EnsureSharedFunctionInfosArrayOnScript(parse_info, isolate);
+  DCHECK_EQ(kNoSourcePosition,
+            parse_info->literal()->function_token_position());
+  Handle<SharedFunctionInfo> shared_info =
+      isolate->factory()->NewSharedFunctionInfoForLiteral(parse_info->literal(),
+                                                          parse_info->script());
+  shared_info->set_is_toplevel(true);
+
+  // Finalize compilation of the unoptimized bytecode or asm-js data.
+  if (!FinalizeUnoptimizedCode(parse_info, isolate, shared_info,
+                               outer_function_job, inner_function_jobs)) {
+    if (!isolate->has_pending_exception()) isolate->StackOverflow();
+    return MaybeHandle<SharedFunctionInfo>();
+  }
+
+  if (!script.is_null()) {
+    script->set_compilation_state(Script::COMPILATION_STATE_COMPILED);
+  }
+
+  return shared_info;
+}
+
 MaybeHandle<SharedFunctionInfo> CompileToplevel(ParseInfo* parse_info,
                                                 Isolate* isolate) {
   TimerEventScope<TimerEventCompileCode> top_level_timer(isolate);
@@ -744,7 +816,6 @@ MaybeHandle<SharedFunctionInfo> CompileToplevel(ParseInfo* parse_info,
       isolate, parse_info->is_eval() ? &RuntimeCallStats::CompileEval
                                      : &RuntimeCallStats::CompileScript);
 
-  Handle<Script> script = parse_info->script();
   Handle<SharedFunctionInfo> result;
   VMState<BYTECODE_COMPILER> state(isolate);
   if (parse_info->literal() == nullptr &&
@@ -765,37 +836,8 @@ MaybeHandle<SharedFunctionInfo> CompileToplevel(ParseInfo* parse_info,
   std::forward_list<std::unique_ptr<CompilationJob>> inner_function_jobs;
   std::unique_ptr<CompilationJob> outer_function_job(
       GenerateUnoptimizedCode(parse_info, isolate, &inner_function_jobs));
-  if (!outer_function_job) {
-    if (!isolate->has_pending_exception()) isolate->StackOverflow();
-    return MaybeHandle<SharedFunctionInfo>();
-  }
-
-  // Internalize ast values onto the heap.
-  parse_info->ast_value_factory()->Internalize(isolate);
-
-  // Create shared function infos for top level and shared function infos array
-  // for inner functions.
-  EnsureSharedFunctionInfosArrayOnScript(parse_info, isolate);
-  DCHECK_EQ(kNoSourcePosition,
-            parse_info->literal()->function_token_position());
-  Handle<SharedFunctionInfo> shared_info =
-      isolate->factory()->NewSharedFunctionInfoForLiteral(parse_info->literal(),
-                                                          parse_info->script());
-  shared_info->set_is_toplevel(true);
-
-  // Finalize compilation of the unoptimized bytecode or asm-js data.
-  if (!FinalizeUnoptimizedCode(parse_info, isolate, shared_info,
-                               outer_function_job.get(),
-                               &inner_function_jobs)) {
-    if (!isolate->has_pending_exception()) isolate->StackOverflow();
-    return MaybeHandle<SharedFunctionInfo>();
-  }
-
-  if (!script.is_null()) {
-    script->set_compilation_state(Script::COMPILATION_STATE_COMPILED);
-  }
-
-  return shared_info;
+  return FinalizeTopLevel(parse_info, isolate, outer_function_job.get(),
+                          &inner_function_jobs);
 }
 
 bool FailWithPendingException(Isolate* isolate,
@@ -808,6 +850,37 @@ bool FailWithPendingException(Isolate* isolate,
   return false;
 }
 
+// Marks the isolate as collecting source positions, see
+// Compiler::CollectSourcePositions.
+class CollectSourcePositionsScope {
+ public:
+  explicit CollectSourcePositionsScope(Isolate* isolate) : isolate_(isolate) {
+    DCHECK(!isolate_->collecting_source_positions());
+    isolate_->set_collecting_source_positions(true);
+  }
+
+  ~CollectSourcePositionsScope() {
+    // Callers are in the middle of capturing a stack trace, nothing done on
+    // their behalf may leave an exception behind.
+    isolate_->clear_pending_exception();
+    isolate_->set_collecting_source_positions(false);
+  }
+
+ private:
+  Isolate* isolate_;
+};
+
+// Maps all of the bytecode of a function to the start of the function, so
+// that it is at least not attributed to the start of the script.
+void SetFunctionStartSourcePosition(Handle<SharedFunctionInfo> shared_info,
+                                    Isolate* isolate) {
+  Zone zone(isolate->allocator(), ZONE_NAME);
+  SourcePositionTableBuilder builder(&zone);
+  builder.AddPosition(0, SourcePosition(shared_info->start_position()), true);
+  Handle<ByteArray> table = builder.ToSourcePositionTable(isolate);
+  shared_info->bytecode_array()->set_source_position_table(*table);
+}
+
 }  // namespace
 
 // ----------------------------------------------------------------------------
@@ -899,6 +972,79 @@ bool Compiler::Compile(Handle<SharedFunctionInfo> shared_info,
   return true;
 }
 
+bool Compiler::CollectSourcePositions(Handle<SharedFunctionInfo> shared_info) {
+  DCHECK(shared_info->has_lazy_source_positions());
+  DCHECK(shared_info->HasBytecodeArray());
+  Isolate* isolate = shared_info->GetIsolate();
+  DCHECK(!isolate->has_pending_exception());
+  DCHECK(AllowCompilation::IsAllowed(isolate));
+
+  // Stack traces are captured while the function is reparsed if it runs into
+  // an error, so collection must not recurse. The positions of the nested
+  // trace remain unavailable, as they do close to the stack limit.
+  if (isolate->collecting_source_positions()) return false;
+  StackLimitCheck check(isolate);
+  if (check.JsHasOverflowed(kStackSpaceRequiredForCompilation * KB)) {
+    return false;
+  }
+
+  CollectSourcePositionsScope collecting_scope(isolate);
+  VMState<BYTECODE_COMPILER> state(isolate);
+  PostponeInterruptsScope postpone(isolate);
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "V8.CollectSourcePositions");
+
+  // Parse the function again and regenerate its bytecode with source
+  // positions. Eager inner functions are compiled already and left alone.
+  // Errors were reported when the function was compiled first, they are not
+  // reported again.
+  ParseInfo parse_info(shared_info);
+  parse_info.set_lazy_compile();
+  parse_info.set_collect_source_positions();
+  if (!parsing::ParseFunction(&parse_info, shared_info, isolate,
+                              parsing::ReportErrorsAndStatisticsMode::kNo)) {
+    return false;
+  }
+
+  std::unique_ptr<CompilationJob> job;
+  {
+    DisallowHeapAllocation no_allocation;
+    DisallowHandleAllocation no_handles;
+    DisallowHandleDereference no_deref;
+    Compiler::EagerInnerFunctionLiterals inner_literals;
+    if (!Compiler::Analyze(&parse_info, &inner_literals)) return false;
+    job.reset(interpreter::Interpreter::NewCompilationJob(
+        &parse_info, parse_info.literal(), isolate));
+    if (job->PrepareJob() != CompilationJob::SUCCEEDED ||
+        job->ExecuteJob() != CompilationJob::SUCCEEDED) {
+      return false;
+    }
+  }
+
+  parse_info.ast_value_factory()->Internalize(isolate);
+  DeclarationScope::AllocateScopeInfos(&parse_info, isolate,
+                                       AnalyzeMode::kRegular);
+  job->compilation_info()->set_shared_info(shared_info);
+  if (job->FinalizeJob() != CompilationJob::SUCCEEDED) return false;
+
+  // Only take the source positions if the bytecode is the same, flags that
+  // change code generation (e.g. block coverage) may have been toggled.
+  // Otherwise the function gets a coarse table now and records its positions
+  // eagerly if it is ever compiled again.
+  Handle<BytecodeArray> bytecode = job->compilation_info()->bytecode_array();
+  BytecodeArray* existing = shared_info->bytecode_array();
+  shared_info->set_has_lazy_source_positions(false);
+  if (bytecode->length() != existing->length() ||
+      memcmp(bytecode->GetFirstBytecodeAddress(),
+             existing->GetFirstBytecodeAddress(), existing->length()) != 0) {
+    shared_info->set_needs_eager_source_positions(true);
+    SetFunctionStartSourcePosition(shared_info, isolate);
+    return false;
+  }
+  existing->set_source_position_table(bytecode->source_position_table());
+  return true;
+}
+
 bool Compiler::Compile(Handle<JSFunction> function, ClearExceptionFlag flag) {
   // We should never reach here if the function is already compiled or optimized
   DCHECK(!function->is_compiled());
@@ -947,6 +1093,13 @@ bool Compiler::CompileOptimized(Handle<JSFunction> function,
   Isolate* isolate = function->GetIsolate();
   DCHECK(AllowCompilation::IsAllowed(isolate));
 
+  // The bytecode may have been flushed after the function was marked for
+  // optimization.
+  if (!function->shared()->is_compiled() &&
+      !Compiler::Compile(handle(function->shared()), KEEP_EXCEPTION)) {
+    return false;
+  }
+
   // Start a compilation.
   Handle<Code> code;
   if (!GetOptimizedCode(function, mode).ToHandle(&code)) {
@@ -1354,8 +1507,9 @@ MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
 }
 
 Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForStreamedScript(
-    Handle<Script> script, ParseInfo* parse_info, int source_length) {
+    Handle<Script> script, StreamedSource* source, int source_length) {
   Isolate* isolate = script->GetIsolate();
+  ParseInfo* parse_info = source->info.get();
   // TODO(titzer): increment the counters in caller.
   isolate->counters()->total_load_size()->Increment(source_length);
   isolate->counters()->total_compile_size()->Increment(source_length);
@@ -1364,13 +1518,45 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForStreamedScript(
   parse_info->set_language_mode(
       stricter_language_mode(parse_info->language_mode(), language_mode));
 
+  MaybeHandle<SharedFunctionInfo> maybe_result;
+  if (source->compiled_on_background) {
+    // Bytecode has been generated on the background thread already, only the
+    // heap objects are left to allocate.
+    PostponeInterruptsScope postpone(isolate);
+    RuntimeCallTimerScope runtimeTimer(
+        isolate, &RuntimeCallStats::CompileFinalizeBackgroundCompile);
+    VMState<BYTECODE_COMPILER> state(isolate);
+    // asm.js modules which failed validation on the background thread have
+    // been compiled to bytecode, report why.
+    for (auto&& failed_asm_job : source->failed_asm_jobs) {
+      AsmJs::ReportDeferredFailure(failed_asm_job.get());
+    }
+    source->failed_asm_jobs.clear();
+    maybe_result =
+        FinalizeTopLevel(parse_info, isolate, source->outer_function_job.get(),
+                         &source->inner_function_jobs);
+  } else {
+    maybe_result = CompileToplevel(parse_info, isolate);
+  }
+
   Handle<SharedFunctionInfo> result;
-  if (CompileToplevel(parse_info, isolate).ToHandle(&result)) {
+  if (maybe_result.ToHandle(&result)) {
     isolate->debug()->OnAfterCompile(script);
   }
   return result;
 }
 
+CompilationJob* Compiler::CompileTopLevelOnBackgroundThread(
+    ParseInfo* parse_info, Isolate* isolate,
+    CompilationJobList* inner_function_jobs,
+    CompilationJobList* failed_asm_jobs) {
+  DCHECK(parse_info->is_toplevel());
+  DCHECK_NOT_NULL(parse_info->literal());
+  return GenerateUnoptimizedCode(parse_info, isolate, inner_function_jobs,
+                                 failed_asm_jobs)
+      .release();
+}
+
 Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfo(
     FunctionLiteral* literal, Handle<Script> script, Isolate* isolate) {
   // Precondition: code has been parsed and scopes have been analyzed.
@@ -1394,6 +1580,16 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfo(
   if (outer_scope) {
     result->set_outer_scope_info(*outer_scope->scope_info());
   }
+  // Validate and translate asm.js modules in the background, so that their
+  // first call only has to finalize the job.
+  if (FLAG_concurrent_asm_translation && UseAsmWasm(literal, false)) {
+    isolate->compiler_dispatcher()->Enqueue(result);
+  }
+  // Speculatively compile functions which the parser expects to be called
+  // soon, so that their first call finds the bytecode ready.
+  if (FLAG_predictive_compile && literal->should_compile_in_background()) {
+    isolate->compiler_dispatcher()->EnqueuePredicted(result);
+  }
   return result;
 }
 
@@ -1441,15 +1637,39 @@ MaybeHandle<Code> Compiler::GetOptimizedCodeForOSR(Handle<JSFunction> function,
 CompilationJob* Compiler::PrepareUnoptimizedCompilationJob(
     ParseInfo* parse_info, Isolate* isolate) {
   VMState<BYTECODE_COMPILER> state(isolate);
+  FunctionLiteral* literal = parse_info->literal();
   std::unique_ptr<CompilationJob> job(
-      interpreter::Interpreter::NewCompilationJob(
-          parse_info, parse_info->literal(), isolate));
+      UseAsmWasm(literal, parse_info->is_asm_wasm_broken())
+          ? AsmJs::NewCompilationJob(parse_info, literal, isolate)
+          : interpreter::Interpreter::NewCompilationJob(parse_info, literal,
+                                                        isolate));
   if (job->PrepareJob() != CompilationJob::SUCCEEDED) {
     return nullptr;
   }
   return job.release();
 }
 
+CompilationJob* Compiler::ReplaceFailedAsmJsJob(CompilationJob* job,
+                                                Isolate* isolate) {
+  DCHECK_EQ(CompilationJob::State::kFailed, job->state());
+  ParseInfo* parse_info = job->parse_info();
+  FunctionLiteral* literal = job->compilation_info()->literal();
+  if (!UseAsmWasm(literal, parse_info->is_asm_wasm_broken())) return nullptr;
+  AsmJs::ReportDeferredFailure(job);
+
+  // Like PrepareAndExecuteUnoptimizedCompileJob, fall through to standard
+  // unoptimized compile.
+  VMState<BYTECODE_COMPILER> state(isolate);
+  std::unique_ptr<CompilationJob> fallback_job(
+      interpreter::Interpreter::NewCompilationJob(parse_info, literal,
+                                                  isolate));
+  if (fallback_job->PrepareJob() != CompilationJob::SUCCEEDED ||
+      fallback_job->ExecuteJob() != CompilationJob::SUCCEEDED) {
+    return nullptr;
+  }
+  return fallback_job.release();
+}
+
 bool Compiler::FinalizeCompilationJob(CompilationJob* raw_job) {
   // Take ownership of compilation job.  Deleting job also tears down the zone.
   std::unique_ptr<CompilationJob> job(raw_job);
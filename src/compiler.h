@@ -5,6 +5,7 @@
 #ifndef V8_COMPILER_H_
 #define V8_COMPILER_H_
 
+#include <forward_list>
 #include <memory>
 
 #include "src/allocation.h"
@@ -22,11 +23,14 @@ class CompilationJob;
 class JavaScriptFrame;
 class ParseInfo;
 class ScriptData;
+struct StreamedSource;
 template <typename T>
 class ThreadedList;
 template <typename T>
 class ThreadedListZoneEntry;
 
+typedef std::forward_list<std::unique_ptr<CompilationJob>> CompilationJobList;
+
 // The V8 compiler API.
 //
 // This is the central hub for dispatching to the various compilers within V8.
@@ -53,10 +57,24 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
   static bool CompileOptimized(Handle<JSFunction> function, ConcurrencyMode);
   static MaybeHandle<JSArray> CompileForLiveEdit(Handle<Script> script);
 
+  // Recompiles a function whose bytecode was generated without source
+  // positions and attaches the source position table of the result to the
+  // existing bytecode. Returns false if that is not possible, in which case
+  // the bytecode may get a table that only holds the start of the function.
+  // No exception is left pending in either case.
+  static bool CollectSourcePositions(Handle<SharedFunctionInfo> shared);
+
   // Prepare a compilation job for unoptimized code. Requires ParseAndAnalyse.
+  // This is an asm.js job if the function is an asm.js module.
   static CompilationJob* PrepareUnoptimizedCompilationJob(ParseInfo* parse_info,
                                                           Isolate* isolate);
 
+  // Replaces an asm.js job which failed validation off the main thread with a
+  // prepared and executed bytecode job for the same function, after reporting
+  // the validation failure. Returns nullptr for other failed jobs.
+  static CompilationJob* ReplaceFailedAsmJsJob(CompilationJob* job,
+                                               Isolate* isolate);
+
   // Generate and install code from previously queued compilation job.
   static bool FinalizeCompilationJob(CompilationJob* job);
 
@@ -117,9 +135,20 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
       MaybeHandle<FixedArray> maybe_host_defined_options);
 
   // Create a shared function info object for a Script that has already been
-  // parsed while the script was being loaded from a streamed source.
+  // parsed (and possibly compiled) while the script was being loaded from a
+  // streamed source.
   static Handle<SharedFunctionInfo> GetSharedFunctionInfoForStreamedScript(
-      Handle<Script> script, ParseInfo* info, int source_length);
+      Handle<Script> script, StreamedSource* source, int source_length);
+
+  // Prepare and execute the compilation jobs for the top-level code and eager
+  // inner functions of a parsed script. Does not touch the heap, so it can run
+  // on the thread which parsed a streamed script. asm.js jobs which failed
+  // validation are kept in {failed_asm_jobs}, their failure has to be reported
+  // on the main thread with AsmJs::ReportDeferredFailure.
+  static CompilationJob* CompileTopLevelOnBackgroundThread(
+      ParseInfo* parse_info, Isolate* isolate,
+      CompilationJobList* inner_function_jobs,
+      CompilationJobList* failed_asm_jobs);
 
   // Create a shared function info object (the code may be lazily compiled).
   static Handle<SharedFunctionInfo> GetSharedFunctionInfo(FunctionLiteral* node,
@@ -169,7 +198,8 @@ class V8_EXPORT_PRIVATE CompilationJob {
                  State initial_state = State::kReadyToPrepare);
   virtual ~CompilationJob() {}
 
-  // Prepare the compile job. Must be called on the main thread.
+  // Prepare the compile job. Must be called on the main thread, except for
+  // unoptimized jobs of scripts compiled on a background thread.
   MUST_USE_RESULT Status PrepareJob();
 
   // Executes the compile job. Can be called on a background thread if
@@ -190,6 +220,11 @@ class V8_EXPORT_PRIVATE CompilationJob {
   void RecordOptimizedCompilationStats() const;
   void RecordUnoptimizedCompilationStats() const;
 
+  // Reports statistics the job gathered while running, possibly off the main
+  // thread, to the isolate's counters. Called on the main thread once the job
+  // is done, whether it succeeded or failed.
+  virtual void ReportCounters() {}
+
   void set_stack_limit(uintptr_t stack_limit) { stack_limit_ = stack_limit; }
   uintptr_t stack_limit() const { return stack_limit_; }
 
@@ -644,6 +644,21 @@ Handle<DeoptimizationData> CodeGenerator::GenerateDeoptimizationData() {
     data->SetSharedFunctionInfo(Smi::kZero);
   }
 
+  if (FLAG_flush_bytecode) {
+    // Deoptimization continues in the bytecode of the function and of the
+    // functions inlined into it, which must not be flushed meanwhile.
+    if (info->has_shared_info() && info->shared_info()->HasBytecodeArray()) {
+      DefineDeoptimizationLiteral(DeoptimizationLiteral(
+          handle(info->shared_info()->bytecode_array(), isolate())));
+    }
+    for (const CompilationInfo::InlinedFunctionHolder& inlined :
+         info->inlined_functions()) {
+      if (!inlined.shared_info->HasBytecodeArray()) continue;
+      DefineDeoptimizationLiteral(DeoptimizationLiteral(
+          handle(inlined.shared_info->bytecode_array(), isolate())));
+    }
+  }
+
   Handle<FixedArray> literals = isolate()->factory()->NewFixedArray(
       static_cast<int>(deoptimization_literals_.size()), TENURED);
   for (unsigned i = 0; i < deoptimization_literals_.size(); i++) {
@@ -0,0 +1,127 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/compilation-budget.h"
+
+#include <algorithm>
+
+#include "src/counters.h"
+#include "src/flags.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+namespace {
+
+int PercentOf(size_t usage, size_t limit) {
+  if (limit == 0) return 0;
+  return static_cast<int>(
+      std::min<uint64_t>(static_cast<uint64_t>(usage) * 100 / limit, kMaxInt));
+}
+
+}  // namespace
+
+CompilationBudget::CompilationBudget()
+    : CompilationBudget(
+          static_cast<size_t>(std::max(0, FLAG_turbo_budget_graph_size)),
+          static_cast<size_t>(std::max(0, FLAG_turbo_budget_zone_size)) * MB,
+          base::TimeDelta::FromMilliseconds(
+              std::max(0, FLAG_turbo_budget_time))) {}
+
+CompilationBudget::CompilationBudget(size_t max_graph_size,
+                                     size_t max_zone_size,
+                                     base::TimeDelta max_time)
+    : max_graph_size_(max_graph_size),
+      max_zone_size_(max_zone_size),
+      max_time_(max_time),
+      graph_size_(0),
+      zone_size_(0),
+      degradations_(kNoDegradation) {}
+
+void CompilationBudget::Resume() {
+  if (!timer_.IsStarted()) timer_.Start();
+}
+
+void CompilationBudget::Pause() {
+  if (!timer_.IsStarted()) return;
+  accumulated_time_ += timer_.Elapsed();
+  timer_.Stop();
+}
+
+base::TimeDelta CompilationBudget::Elapsed() const {
+  if (!timer_.IsStarted()) return accumulated_time_;
+  return accumulated_time_ + timer_.Elapsed();
+}
+
+void CompilationBudget::Update(size_t graph_size, size_t zone_size) {
+  Update(graph_size, zone_size, Elapsed());
+}
+
+void CompilationBudget::Update(size_t graph_size, size_t zone_size,
+                               base::TimeDelta elapsed) {
+  graph_size_ = graph_size;
+  zone_size_ = zone_size;
+  elapsed_ = elapsed;
+}
+
+int CompilationBudget::UsagePercent() const {
+  int percent = std::max(PercentOf(graph_size_, max_graph_size_),
+                         PercentOf(zone_size_, max_zone_size_));
+  if (max_time_ > base::TimeDelta()) {
+    percent = std::max(
+        percent, PercentOf(static_cast<size_t>(elapsed_.InMicroseconds()),
+                           static_cast<size_t>(max_time_.InMicroseconds())));
+  }
+  return percent;
+}
+
+// static
+int CompilationBudget::ThresholdPercentFor(Degradation degradation) {
+  switch (degradation) {
+    case kInliningDisabled:
+      // Inlining typically grows the graph by a large factor, so stop early
+      // enough to leave room for the rest of the pipeline.
+      return 50;
+    case kLoadEliminationSkipped:
+    case kEscapeAnalysisSkipped:
+      return 100;
+    case kAborted:
+      return 200;
+    case kNoDegradation:
+      break;
+  }
+  UNREACHABLE();
+}
+
+bool CompilationBudget::Degrade(Degradation degradation) {
+  if (UsagePercent() < ThresholdPercentFor(degradation)) return false;
+  degradations_ |= degradation;
+  if (FLAG_trace_turbo_budget) {
+    PrintF("[budget: degradation %d at %d%% (%" PRIuS " nodes, %" PRIuS
+           " zone bytes, %.3f ms)]\n",
+           degradation, UsagePercent(), graph_size_, zone_size_,
+           elapsed_.InMillisecondsF());
+  }
+  return true;
+}
+
+void CompilationBudget::UpdateCounters(Counters* counters) const {
+  if (HasDegradation(kInliningDisabled)) {
+    counters->turbofan_budget_inlining_disabled()->Increment();
+  }
+  if (HasDegradation(kLoadEliminationSkipped)) {
+    counters->turbofan_budget_load_elimination_skipped()->Increment();
+  }
+  if (HasDegradation(kEscapeAnalysisSkipped)) {
+    counters->turbofan_budget_escape_analysis_skipped()->Increment();
+  }
+  if (HasDegradation(kAborted)) {
+    counters->turbofan_budget_aborted()->Increment();
+  }
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
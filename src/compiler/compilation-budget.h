@@ -0,0 +1,84 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_COMPILATION_BUDGET_H_
+#define V8_COMPILER_COMPILATION_BUDGET_H_
+
+#include "src/base/platform/elapsed-timer.h"
+#include "src/globals.h"
+
+namespace v8 {
+namespace internal {
+
+class Counters;
+
+namespace compiler {
+
+// Tracks the graph size, the zone memory and the time spent while optimizing
+// a single function, and decides how the pipeline degrades once the budget
+// is used up: first inlining is disabled, then optional optimization phases
+// are skipped, and finally the compilation is aborted.
+class V8_EXPORT_PRIVATE CompilationBudget final {
+ public:
+  enum Degradation {
+    kNoDegradation = 0,
+    kInliningDisabled = 1 << 0,
+    kLoadEliminationSkipped = 1 << 1,
+    kEscapeAnalysisSkipped = 1 << 2,
+    kAborted = 1 << 3
+  };
+
+  // Creates a budget with the limits given by the --turbo-budget-* flags.
+  CompilationBudget();
+  // A limit of zero means that the corresponding resource is unlimited.
+  CompilationBudget(size_t max_graph_size, size_t max_zone_size,
+                    base::TimeDelta max_time);
+
+  // Only the time between Resume and Pause counts against the budget, so
+  // that the time a job spends waiting in a compilation queue is ignored.
+  void Resume();
+  void Pause();
+
+  // Records the current resource usage of the compilation.
+  void Update(size_t graph_size, size_t zone_size);
+  void Update(size_t graph_size, size_t zone_size, base::TimeDelta elapsed);
+
+  // Returns the usage of the most exhausted resource in percent of its limit.
+  int UsagePercent() const;
+
+  // Returns true if the pipeline should degrade in the given way at the last
+  // recorded usage, and records the degradation if so.
+  bool Degrade(Degradation degradation);
+
+  bool HasDegradation(Degradation degradation) const {
+    return (degradations_ & degradation) != 0;
+  }
+
+  // Reports the recorded degradations to the isolate's counters. Must be
+  // called on the main thread.
+  void UpdateCounters(Counters* counters) const;
+
+ private:
+  static int ThresholdPercentFor(Degradation degradation);
+  base::TimeDelta Elapsed() const;
+
+  size_t const max_graph_size_;
+  size_t const max_zone_size_;
+  base::TimeDelta const max_time_;
+
+  size_t graph_size_;
+  size_t zone_size_;
+  base::TimeDelta elapsed_;
+  base::TimeDelta accumulated_time_;
+  base::ElapsedTimer timer_;
+  int degradations_;
+
+  DISALLOW_COPY_AND_ASSIGN(CompilationBudget);
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_COMPILATION_BUDGET_H_
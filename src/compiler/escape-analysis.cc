@@ -218,6 +218,11 @@ class EscapeAnalysisTracker : public ZoneObject {
 
     void MarkForDeletion() { SetReplacement(tracker_->jsgraph_->Dead()); }
 
+    // The replacement the current node got on its previous visit, if any.
+    Node* PreviousReplacement() {
+      return tracker_->GetReplacementOf(current_node());
+    }
+
     ~Scope() {
       if (replacement_ != tracker_->replacements_[current_node()] ||
           vobject_ != tracker_->virtual_objects_.Get(current_node())) {
@@ -497,6 +502,8 @@ Maybe<int> OffsetOfElementsAccess(const Operator* op, Node* index_node) {
   double min = index_type->Min();
   int index = static_cast<int>(min);
   if (!(index == min && index == max)) return Nothing<int>();
+  // Offsets of negative indices would alias the header fields.
+  if (index < 0) return Nothing<int>();
   ElementAccess access = ElementAccessOf(op);
   DCHECK_GE(ElementSizeLog2Of(access.machine_type.representation()),
             kPointerSizeLog2);
@@ -504,6 +511,25 @@ Maybe<int> OffsetOfElementsAccess(const Operator* op, Node* index_node) {
                                         access.machine_type.representation())));
 }
 
+// Loads from small fixed-length arrays are frequently indexed by a value that
+// is not constant but has a small known range, e.g. {pair[i & 1]}. We replace
+// such loads by a chain of selects over the candidate elements, as long as the
+// range does not exceed this limit.
+const int kMaxElementsIndexRange = 4;
+
+bool IndexRangeOfElementsAccess(Node* index_node, int* min, int* max) {
+  Type* index_type = NodeProperties::GetType(index_node);
+  if (!index_type->Is(Type::Integral32())) return false;
+  // Offsets of negative indices would alias the map and length fields.
+  if (index_type->Min() < 0) return false;
+  if (index_type->Max() - index_type->Min() >= kMaxElementsIndexRange) {
+    return false;
+  }
+  *min = static_cast<int>(index_type->Min());
+  *max = static_cast<int>(index_type->Max());
+  return true;
+}
+
 Node* LowerCompareMapsWithoutLoad(Node* checked_map,
                                   ZoneHandleSet<Map> const& checked_against,
                                   JSGraph* jsgraph) {
@@ -529,6 +555,92 @@ Node* LowerCompareMapsWithoutLoad(Node* checked_map,
   return replacement;
 }
 
+// Checks whether {node} is a chain of selects over {index} for the range
+// [{min_index}, {max_index}], as built by {LowerLoadElementWithoutLoad}.
+bool IsSelectChainForIndexRange(Node* node, MachineRepresentation rep,
+                                Node* index, int min_index, int max_index) {
+  for (int index_value = min_index; index_value < max_index; ++index_value) {
+    if (node == nullptr || node->opcode() != IrOpcode::kSelect) return false;
+    if (SelectParametersOf(node->op()).representation() != rep) return false;
+    Node* check = NodeProperties::GetValueInput(node, 0);
+    if (check->opcode() != IrOpcode::kNumberEqual) return false;
+    if (NodeProperties::GetValueInput(check, 0) != index) return false;
+    NumberMatcher constant(NodeProperties::GetValueInput(check, 1));
+    if (!constant.Is(index_value)) return false;
+    node = NodeProperties::GetValueInput(node, 2);
+  }
+  return true;
+}
+
+// Returns the replacement for a LoadElement from {vobject} with an index of
+// small range, or nullptr if the load cannot be replaced. Sets {*incomplete}
+// if some element has no value yet, i.e. the fixed-point is not reached.
+Node* LowerLoadElementWithoutLoad(const Operator* op, Node* index,
+                                  const VirtualObject* vobject,
+                                  EscapeAnalysisTracker::Scope* current,
+                                  JSGraph* jsgraph, bool* incomplete) {
+  int min_index, max_index;
+  if (!IndexRangeOfElementsAccess(index, &min_index, &max_index)) {
+    return nullptr;
+  }
+  ElementAccess const& access = ElementAccessOf(op);
+  MachineRepresentation rep = access.machine_type.representation();
+  if (!IsAnyTagged(rep)) return nullptr;
+  Node* values[kMaxElementsIndexRange];
+  for (int index_value = min_index; index_value <= max_index; ++index_value) {
+    int offset = access.header_size + (index_value << ElementSizeLog2Of(rep));
+    Variable var;
+    if (!vobject->FieldAt(offset).To(&var)) return nullptr;
+    Node* value = current->Get(var);
+    if (value == nullptr) {
+      *incomplete = true;
+      return nullptr;
+    }
+    if (value == jsgraph->Dead()) return nullptr;
+    values[index_value - min_index] = value;
+  }
+  // The elements flow into select nodes, which we do not track.
+  for (int i = 0; i <= max_index - min_index; ++i) {
+    current->SetEscaped(values[i]);
+  }
+  if (min_index == max_index) return values[0];
+  // Like phis, the selects from a previous visit are reused and only their
+  // element inputs are updated, so that revisits do not grow the graph.
+  Node* previous = current->PreviousReplacement();
+  if (IsSelectChainForIndexRange(previous, rep, index, min_index, max_index)) {
+    Node* select = previous;
+    for (int index_value = min_index; index_value < max_index; ++index_value) {
+      NodeProperties::ReplaceValueInput(select, values[index_value - min_index],
+                                        1);
+      if (index_value + 1 == max_index) {
+        NodeProperties::ReplaceValueInput(
+            select, values[max_index - min_index], 2);
+      }
+      select = NodeProperties::GetValueInput(select, 2);
+    }
+    return previous;
+  }
+  Graph* graph = jsgraph->graph();
+  Node* replacement = values[max_index - min_index];
+  for (int index_value = max_index - 1; index_value >= min_index;
+       --index_value) {
+    Node* constant = jsgraph->Constant(index_value);
+    if (!NodeProperties::IsTyped(constant)) {
+      NodeProperties::SetType(constant,
+                              Type::NewConstant(index_value, graph->zone()));
+    }
+    Node* check =
+        graph->NewNode(jsgraph->simplified()->NumberEqual(), index, constant);
+    NodeProperties::SetType(check, Type::Boolean());
+    replacement = graph->NewNode(jsgraph->common()->Select(rep), check,
+                                 values[index_value - min_index], replacement);
+    // As for phis, the precise type is recovered by a TypeGuard in the
+    // reducer if necessary.
+    NodeProperties::SetType(replacement, Type::Any());
+  }
+  return replacement;
+}
+
 void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
                 JSGraph* jsgraph) {
   switch (op->opcode()) {
@@ -607,9 +719,20 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
           OffsetOfElementsAccess(op, index).To(&offset) &&
           vobject->FieldAt(offset).To(&var)) {
         current->SetReplacement(current->Get(var));
-      } else {
-        current->SetEscaped(object);
+        break;
       }
+      if (vobject && !vobject->HasEscaped()) {
+        bool incomplete = false;
+        if (Node* replacement = LowerLoadElementWithoutLoad(
+                op, index, vobject, current, jsgraph, &incomplete)) {
+          current->SetReplacement(replacement);
+          break;
+        }
+        // If some element has no value, we have not reached the fixed-point
+        // yet.
+        if (incomplete) break;
+      }
+      current->SetEscaped(object);
       break;
     }
     case IrOpcode::kTypeGuard: {
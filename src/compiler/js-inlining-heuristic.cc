@@ -205,7 +205,10 @@ void JSInliningHeuristic::Finalize() {
 
   // We inline at most one candidate in every iteration of the fixpoint.
   // This is to ensure that we don't consume the full inlining budget
-  // on things that aren't called very often.
+  // on things that aren't called very often. Candidates are visited in
+  // order of decreasing benefit/cost (see {CandidateCompare}), and ones
+  // that no longer fit into the remaining budget are skipped rather than
+  // ending the search.
   // TODO(bmeurer): Use std::priority_queue instead of std::set here.
   while (!candidates_.empty()) {
     auto i = candidates_.begin();
@@ -713,22 +716,41 @@ bool JSInliningHeuristic::CandidateCompare::operator()(
     return true;
   } else if (left.frequency.IsUnknown()) {
     return false;
-  } else if (left.frequency.value() > right.frequency.value()) {
+  }
+  // Order candidates with known frequency by their benefit/cost ratio, i.e.
+  // the number of times the call site is hit per invocation of the caller,
+  // divided by the bytecode size that inlining would add. That way the
+  // cumulative inlining budget is spent on the call sites that buy the most
+  // per bytecode, rather than on the first big function that is hot.
+  double const left_benefit = Benefit(left);
+  double const right_benefit = Benefit(right);
+  if (left_benefit > right_benefit) {
     return true;
-  } else if (left.frequency.value() < right.frequency.value()) {
+  } else if (left_benefit < right_benefit) {
     return false;
   } else {
     return left.node->id() > right.node->id();
   }
 }
 
+// static
+double JSInliningHeuristic::Benefit(const Candidate& candidate) {
+  DCHECK(candidate.frequency.IsKnown());
+  DCHECK_LT(0, candidate.total_size);
+  return candidate.frequency.value() / candidate.total_size;
+}
+
 void JSInliningHeuristic::PrintCandidates() {
   OFStream os(stdout);
   os << "Candidates for inlining (size=" << candidates_.size() << "):\n";
   for (const Candidate& candidate : candidates_) {
     os << "  #" << candidate.node->id() << ":"
        << candidate.node->op()->mnemonic()
-       << ", frequency: " << candidate.frequency << std::endl;
+       << ", frequency: " << candidate.frequency;
+    if (candidate.frequency.IsKnown()) {
+      os << ", benefit: " << Benefit(candidate);
+    }
+    os << std::endl;
     for (int i = 0; i < candidate.num_functions; ++i) {
       Handle<SharedFunctionInfo> shared =
           candidate.functions[i].is_null()
@@ -53,6 +53,10 @@ class JSInliningHeuristic final : public AdvancedReducer {
     int total_size = 0;
   };
 
+  // Estimated benefit of inlining {candidate} per bytecode of cost, based on
+  // the call frequency relative to the caller's invocation count.
+  static double Benefit(const Candidate& candidate);
+
   // Comparator for candidates.
   struct CandidateCompare {
     bool operator()(const Candidate& left, const Candidate& right) const;
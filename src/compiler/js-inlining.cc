@@ -517,6 +517,9 @@ Reduction JSInliner::ReduceJSCall(Node* node) {
     return NoChange();
   }
 
+  // The subgraph takes its source positions from the bytecode.
+  SharedFunctionInfo::EnsureSourcePositionsAvailable(shared_info);
+
   // ----------------------------------------------------------------
   // After this point, we've made a decision to inline this function.
   // We shall not bailout from inlining if we got here.
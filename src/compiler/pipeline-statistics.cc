@@ -5,6 +5,7 @@
 #include <memory>
 
 #include "src/compilation-info.h"
+#include "src/compiler/instruction.h"
 #include "src/compiler/pipeline-statistics.h"
 #include "src/compiler/zone-stats.h"
 #include "src/isolate.h"
@@ -102,6 +103,38 @@ void PipelineStatistics::EndPhase() {
   compilation_stats_->RecordPhaseStats(phase_kind_name_, phase_name_, diff);
 }
 
+void PipelineStatistics::RecordMoveStats(const InstructionSequence* code) {
+  CompilationStatistics::MoveStats stats;
+  stats.function_name_ = function_name_;
+  for (const InstructionBlock* block : code->instruction_blocks()) {
+    bool in_loop = block->IsLoopHeader() || block->loop_header().IsValid();
+    for (int i = block->code_start(); i < block->code_end(); ++i) {
+      const Instruction* instr = code->InstructionAt(i);
+      for (int j = Instruction::FIRST_GAP_POSITION;
+           j <= Instruction::LAST_GAP_POSITION; ++j) {
+        const ParallelMove* moves =
+            instr->GetParallelMove(static_cast<Instruction::GapPosition>(j));
+        if (moves == nullptr) continue;
+        for (const MoveOperands* move : *moves) {
+          if (move->IsRedundant()) continue;
+          const InstructionOperand& source = move->source();
+          const InstructionOperand& destination = move->destination();
+          if (source.IsAnyRegister() && destination.IsAnyStackSlot()) {
+            stats.spills_++;
+            if (in_loop) stats.loop_spills_++;
+          } else if (source.IsAnyStackSlot() && destination.IsAnyRegister()) {
+            stats.reloads_++;
+            if (in_loop) stats.loop_reloads_++;
+          } else {
+            stats.moves_++;
+          }
+        }
+      }
+    }
+  }
+  compilation_stats_->RecordMoveStats(stats);
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
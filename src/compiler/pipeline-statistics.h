@@ -16,6 +16,7 @@ namespace v8 {
 namespace internal {
 namespace compiler {
 
+class InstructionSequence;
 class PhaseScope;
 
 class PipelineStatistics : public Malloced {
@@ -26,6 +27,9 @@ class PipelineStatistics : public Malloced {
   void BeginPhaseKind(const char* phase_kind_name);
   void EndPhaseKind();
 
+  // Counts the gap moves left in {code} after register allocation.
+  void RecordMoveStats(const InstructionSequence* code);
+
  private:
   size_t OuterZoneSize() {
     return static_cast<size_t>(outer_zone_->allocation_size());
@@ -21,6 +21,7 @@
 #include "src/compiler/checkpoint-elimination.h"
 #include "src/compiler/code-generator.h"
 #include "src/compiler/common-operator-reducer.h"
+#include "src/compiler/compilation-budget.h"
 #include "src/compiler/compiler-source-position-table.h"
 #include "src/compiler/control-flow-optimizer.h"
 #include "src/compiler/dead-code-elimination.h"
@@ -188,6 +189,7 @@ class PipelineData {
   CompilationInfo* info() const { return info_; }
   ZoneStats* zone_stats() const { return zone_stats_; }
   PipelineStatistics* pipeline_statistics() { return pipeline_statistics_; }
+  CompilationBudget* budget() { return &budget_; }
   OsrHelper* osr_helper() { return &(*osr_helper_); }
   bool compilation_failed() const { return compilation_failed_; }
   void set_compilation_failed() { compilation_failed_ = true; }
@@ -364,6 +366,7 @@ class PipelineData {
   bool may_have_unverifiable_graph_ = true;
   ZoneStats* const zone_stats_;
   PipelineStatistics* pipeline_statistics_ = nullptr;
+  CompilationBudget budget_;
   bool compilation_failed_ = false;
   bool verify_graph_ = false;
   int start_source_position_ = kNoSourcePosition;
@@ -444,6 +447,7 @@ class PipelineImpl final {
   Handle<Code> FinalizeCode();
 
   bool ScheduleAndSelectInstructions(Linkage* linkage, bool trim_graph);
+  bool ExceedsBudget(CompilationBudget::Degradation degradation);
   void RunPrintAndVerify(const char* phase, bool untyped = false);
   Handle<Code> ScheduleAndGenerateCode(CallDescriptor* call_descriptor);
   void AllocateRegisters(const RegisterConfiguration* config,
@@ -756,6 +760,10 @@ class PipelineCompilationJob final : public CompilationJob {
   Status ExecuteJobImpl() final;
   Status FinalizeJobImpl() final;
 
+  void ReportCounters() final {
+    data_.budget()->UpdateCounters(isolate()->counters());
+  }
+
   Isolate* isolate() { return isolate_; }
 
   // Registers weak object to optimized code dependencies.
@@ -792,6 +800,10 @@ PipelineCompilationJob::Status PipelineCompilationJob::PrepareJobImpl() {
     compilation_info()->MarkAsFunctionContextSpecializing();
   }
 
+  // The graph takes its source positions from the bytecode.
+  SharedFunctionInfo::EnsureSourcePositionsAvailable(
+      compilation_info()->shared_info());
+
   data_.set_start_source_position(
       compilation_info()->shared_info()->start_position());
 
@@ -800,6 +812,9 @@ PipelineCompilationJob::Status PipelineCompilationJob::PrepareJobImpl() {
 
   if (!pipeline_.CreateGraph()) {
     if (isolate()->has_pending_exception()) return FAILED;  // Stack overflowed.
+    if (data_.budget()->HasDegradation(CompilationBudget::kAborted)) {
+      return AbortOptimization(kOptimizationBudgetExceeded);
+    }
     return AbortOptimization(kGraphBuildingFailed);
   }
 
@@ -1789,10 +1804,18 @@ bool PipelineImpl::CreateGraph() {
   }
 
   data->source_positions()->AddDecorator();
+  data->budget()->Resume();
 
   Run<GraphBuilderPhase>();
   RunPrintAndVerify("Initial untyped", true);
 
+  // Once the inlining budget is used up, no further calls are inlined; the
+  // inlining phase below still runs its specializations and call reductions.
+  if (info()->is_inlining_enabled() &&
+      ExceedsBudget(CompilationBudget::kInliningDisabled)) {
+    info()->MarkAsInliningDisabled();
+  }
+
   // Perform function context specialization and inlining (if enabled).
   Run<InliningPhase>();
   RunPrintAndVerify("Inlined", true);
@@ -1832,6 +1855,10 @@ bool PipelineImpl::CreateGraph() {
   Run<ConcurrentOptimizationPrepPhase>();
 
   data->EndPhaseKind();
+  data->budget()->Pause();
+
+  // Give up on functions whose graph is way beyond the budget already.
+  if (ExceedsBudget(CompilationBudget::kAborted)) return false;
 
   return true;
 }
@@ -1840,6 +1867,7 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
   PipelineData* data = this->data_;
 
   data->BeginPhaseKind("lowering");
+  data->budget()->Resume();
 
   if (data->info()->is_loop_peeling_enabled()) {
     Run<LoopPeelingPhase>();
@@ -1849,12 +1877,14 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
     RunPrintAndVerify("Loop exits eliminated", true);
   }
 
-  if (FLAG_turbo_load_elimination) {
+  if (FLAG_turbo_load_elimination &&
+      !ExceedsBudget(CompilationBudget::kLoadEliminationSkipped)) {
     Run<LoadEliminationPhase>();
     RunPrintAndVerify("Load eliminated");
   }
 
-  if (FLAG_turbo_escape) {
+  if (FLAG_turbo_escape &&
+      !ExceedsBudget(CompilationBudget::kEscapeAnalysisSkipped)) {
     Run<EscapeAnalysisPhase>();
     if (data->compilation_failed()) {
       info()->AbortOptimization(kCyclicObjectStateDetectedInEscapeAnalysis);
@@ -2302,6 +2332,10 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
 
   Run<LocateSpillSlotsPhase>();
 
+  if (data->pipeline_statistics() != nullptr) {
+    data->pipeline_statistics()->RecordMoveStats(data->sequence());
+  }
+
   if (FLAG_trace_turbo_graph) {
     AllowHandleDereference allow_deref;
     CodeTracer::Scope tracing_scope(isolate()->GetCodeTracer());
@@ -2324,6 +2358,13 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
   data->DeleteRegisterAllocationZone();
 }
 
+bool PipelineImpl::ExceedsBudget(CompilationBudget::Degradation degradation) {
+  PipelineData* data = this->data_;
+  data->budget()->Update(data->graph()->NodeCount(),
+                         data->zone_stats()->GetCurrentAllocatedBytes());
+  return data->budget()->Degrade(degradation);
+}
+
 CompilationInfo* PipelineImpl::info() const { return data_->info(); }
 
 Isolate* PipelineImpl::isolate() const { return info()->isolate(); }
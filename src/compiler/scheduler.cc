@@ -613,6 +613,8 @@ void Scheduler::BuildCFG() {
   control_flow_builder_ = new (zone_) CFGBuilder(zone_, this);
   control_flow_builder_->Run();
 
+  if (FLAG_turbo_defer_cold_paths) MarkColdPathsDeferred();
+
   // Initialize per-block data.
   // Reserve an extra 10% to avoid resizing vector when fusing floating control.
   scheduled_nodes_.reserve(schedule_->BasicBlockCount() * 1.1);
@@ -620,6 +622,79 @@ void Scheduler::BuildCFG() {
 }
 
 
+// Marks blocks from which every path ends in a deoptimization or a throw as
+// deferred, so that the code generator moves them out of line together with
+// the blocks marked by branch hints. A block is only marked if all of its
+// successors are marked as well and, when it has multiple predecessors, all of
+// them are marked too. This keeps the invariants checked by
+// InstructionSequence::ValidateDeferredBlockEntryPaths and
+// ValidateDeferredBlockExitPaths, and it guarantees that values defined in
+// deferred code are only used in deferred code.
+void Scheduler::MarkColdPathsDeferred() {
+  TRACE("--- MARKING COLD PATHS -------------------------------------\n");
+
+  const BasicBlockVector& blocks = *schedule_->all_blocks();
+  BasicBlock* const end = schedule_->end();
+  ZoneVector<bool> cold(blocks.size(), false, zone_);
+  ZoneQueue<BasicBlock*> queue(zone_);
+
+  // Optimistically consider all blocks that don't return cold and remove
+  // blocks from the cold set until a fixed point is reached.
+  for (BasicBlock* block : blocks) {
+    if (block == schedule_->start() || block == end) continue;
+    switch (block->control()) {
+      case BasicBlock::kNone:
+      case BasicBlock::kReturn:
+      case BasicBlock::kTailCall:
+        continue;
+      default:
+        cold[block->id().ToSize()] = true;
+        break;
+    }
+  }
+  for (BasicBlock* block : blocks) queue.push(block);
+
+  while (!queue.empty()) {
+    BasicBlock* block = queue.front();
+    queue.pop();
+    if (!cold[block->id().ToSize()]) continue;
+    bool is_cold = true;
+    if (block->control() != BasicBlock::kDeoptimize &&
+        block->control() != BasicBlock::kThrow) {
+      for (BasicBlock* successor : block->successors()) {
+        if (successor == end || !cold[successor->id().ToSize()]) {
+          is_cold = false;
+          break;
+        }
+      }
+    }
+    if (is_cold && block->PredecessorCount() > 1) {
+      for (BasicBlock* predecessor : block->predecessors()) {
+        if (!cold[predecessor->id().ToSize()]) {
+          is_cold = false;
+          break;
+        }
+      }
+    }
+    if (is_cold) continue;
+    cold[block->id().ToSize()] = false;
+    for (BasicBlock* predecessor : block->predecessors()) {
+      queue.push(predecessor);
+    }
+    for (BasicBlock* successor : block->successors()) {
+      queue.push(successor);
+    }
+  }
+
+  for (BasicBlock* block : blocks) {
+    if (cold[block->id().ToSize()] && !block->deferred()) {
+      TRACE("Marking cold block id:%d as deferred\n", block->id().ToInt());
+      block->set_deferred(true);
+    }
+  }
+}
+
+
 // -----------------------------------------------------------------------------
 // Phase 2: Compute special RPO and dominator tree.
 
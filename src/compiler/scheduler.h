@@ -99,6 +99,7 @@ class V8_EXPORT_PRIVATE Scheduler {
   // Phase 1: Build control-flow graph.
   friend class CFGBuilder;
   void BuildCFG();
+  void MarkColdPathsDeferred();
 
   // Phase 2: Compute special RPO and dominator tree.
   friend class SpecialRPONumberer;
@@ -79,7 +79,6 @@ WasmGraphBuilder::WasmGraphBuilder(
       env_(env),
       signature_tables_(zone),
       function_tables_(zone),
-      function_table_sizes_(zone),
       cur_buffer_(def_buffer_),
       cur_bufsize_(kDefaultBufferSize),
       runtime_exception_support_(exception_support),
@@ -2390,8 +2389,15 @@ Node* WasmGraphBuilder::CallIndirect(uint32_t sig_index, Node** args,
   MachineOperatorBuilder* machine = jsgraph()->machine();
   Node* key = args[0];
 
-  // Bounds check against the table size.
-  Node* size = function_table_sizes_[table_index];
+  // Bounds check against the table size, which is loaded from the
+  // WasmContext as the table can grow.
+  DCHECK_NOT_NULL(wasm_context_);
+  Node* size = graph()->NewNode(
+      machine->Load(MachineType::Uint32()), wasm_context_,
+      jsgraph()->Int32Constant(
+          static_cast<int32_t>(offsetof(WasmContext, function_table_size))),
+      *effect_, *control_);
+  *effect_ = size;
   Node* in_bounds = graph()->NewNode(machine->Uint32LessThan(), key, size);
   TrapIfFalse(wasm::kTrapFuncInvalid, in_bounds, position);
   Node* table_address = function_tables_[table_index];
@@ -2655,33 +2661,50 @@ Node* WasmGraphBuilder::BuildChangeTaggedToFloat64(Node* value) {
 Node* WasmGraphBuilder::FromJS(Node* node, Node* js_context,
                                wasm::ValueType type) {
   DCHECK_NE(wasm::kWasmStmt, type);
+  MachineOperatorBuilder* machine = jsgraph()->machine();
+
+  // Smis are the common case at the JS boundary. Convert them inline and only
+  // call the ToNumber builtin for other values.
+  Diamond not_smi(graph(), jsgraph()->common(), BuildTestNotSmi(node),
+                  BranchHint::kFalse);
+  not_smi.Chain(*control_);
+  Node* old_effect = *effect_;
+  *control_ = not_smi.if_true;
 
   // Do a JavaScript ToNumber.
   Node* num = BuildJavaScriptToNumber(node, js_context);
 
   // Change representation.
-  SimplifiedOperatorBuilder simplified(jsgraph()->zone());
   num = BuildChangeTaggedToFloat64(num);
+  Node* smi = BuildChangeSmiToInt32(node);
 
+  MachineRepresentation rep;
   switch (type) {
     case wasm::kWasmI32: {
-      num = graph()->NewNode(jsgraph()->machine()->TruncateFloat64ToWord32(),
-                             num);
+      num = graph()->NewNode(machine->TruncateFloat64ToWord32(), num);
+      rep = MachineRepresentation::kWord32;
       break;
     }
     case wasm::kWasmS128:
     case wasm::kWasmI64:
       UNREACHABLE();
     case wasm::kWasmF32:
-      num = graph()->NewNode(jsgraph()->machine()->TruncateFloat64ToFloat32(),
-                             num);
+      num = graph()->NewNode(machine->TruncateFloat64ToFloat32(), num);
+      smi = graph()->NewNode(machine->RoundInt32ToFloat32(), smi);
+      rep = MachineRepresentation::kFloat32;
       break;
     case wasm::kWasmF64:
+      smi = graph()->NewNode(machine->ChangeInt32ToFloat64(), smi);
+      rep = MachineRepresentation::kFloat64;
       break;
     default:
       UNREACHABLE();
   }
-  return num;
+
+  *effect_ = graph()->NewNode(jsgraph()->common()->EffectPhi(2), *effect_,
+                              old_effect, not_smi.merge);
+  *control_ = not_smi.merge;
+  return not_smi.Phi(rep, num, smi);
 }
 
 Node* WasmGraphBuilder::BuildChangeInt32ToSmi(Node* value) {
@@ -3290,10 +3313,6 @@ void WasmGraphBuilder::EnsureFunctionTableNodes() {
     signature_tables_.push_back(jsgraph()->RelocatableIntPtrConstant(
         reinterpret_cast<intptr_t>(signature_handle_address),
         RelocInfo::WASM_GLOBAL_HANDLE));
-    uint32_t table_size = env_->module->function_tables[i].initial_size;
-    function_table_sizes_.push_back(jsgraph()->RelocatableInt32Constant(
-        static_cast<uint32_t>(table_size),
-        RelocInfo::WASM_FUNCTION_TABLE_SIZE_REFERENCE));
   }
 }
 
@@ -4175,6 +4194,62 @@ Node* WasmGraphBuilder::AtomicOp(wasm::WasmOpcode opcode, Node* const* inputs,
 #undef ATOMIC_LOAD_LIST
 #undef ATOMIC_STORE_LIST
 
+Node* WasmGraphBuilder::BoundsCheckMemRange(Node* start, Node* size,
+                                            wasm::WasmCodePosition position) {
+  MachineOperatorBuilder* m = jsgraph()->machine();
+  DCHECK_NOT_NULL(*mem_size_);
+  if (m->Is64()) {
+    // {start + size} cannot overflow in 64 bits, so one check suffices.
+    start = graph()->NewNode(m->ChangeUint32ToUint64(), start);
+    if (!FLAG_wasm_no_bounds_checks) {
+      Node* end = graph()->NewNode(
+          m->Int64Add(), start,
+          graph()->NewNode(m->ChangeUint32ToUint64(), size));
+      TrapIfFalse(wasm::kTrapMemOutOfBounds,
+                  graph()->NewNode(m->Uint64LessThanOrEqual(), end,
+                                   *mem_size_),
+                  position);
+    }
+  } else if (!FLAG_wasm_no_bounds_checks) {
+    // Check {size <= mem_size} first so that {mem_size - size} cannot wrap.
+    TrapIfFalse(wasm::kTrapMemOutOfBounds,
+                graph()->NewNode(m->Uint32LessThanOrEqual(), size, *mem_size_),
+                position);
+    Node* limit = graph()->NewNode(m->Int32Sub(), *mem_size_, size);
+    TrapIfFalse(wasm::kTrapMemOutOfBounds,
+                graph()->NewNode(m->Uint32LessThanOrEqual(), start, limit),
+                position);
+  }
+  return graph()->NewNode(m->IntAdd(), MemBuffer(0), start);
+}
+
+Node* WasmGraphBuilder::MemoryCopy(Node* dst, Node* src, Node* size,
+                                   wasm::WasmCodePosition position) {
+  // Check both ranges before touching memory, so that an out-of-bounds copy
+  // traps without writing anything.
+  dst = BoundsCheckMemRange(dst, size, position);
+  src = BoundsCheckMemRange(src, size, position);
+  MachineSignature::Builder sig_builder(jsgraph()->zone(), 0, 3);
+  sig_builder.AddParam(MachineType::Pointer());
+  sig_builder.AddParam(MachineType::Pointer());
+  sig_builder.AddParam(MachineType::Uint32());
+  Node* function = graph()->NewNode(jsgraph()->common()->ExternalConstant(
+      ExternalReference::wasm_memory_copy(jsgraph()->isolate())));
+  return BuildCCall(sig_builder.Build(), function, dst, src, size);
+}
+
+Node* WasmGraphBuilder::MemoryFill(Node* dst, Node* value, Node* size,
+                                   wasm::WasmCodePosition position) {
+  dst = BoundsCheckMemRange(dst, size, position);
+  MachineSignature::Builder sig_builder(jsgraph()->zone(), 0, 3);
+  sig_builder.AddParam(MachineType::Pointer());
+  sig_builder.AddParam(MachineType::Uint32());
+  sig_builder.AddParam(MachineType::Uint32());
+  Node* function = graph()->NewNode(jsgraph()->common()->ExternalConstant(
+      ExternalReference::wasm_memory_fill(jsgraph()->isolate())));
+  return BuildCCall(sig_builder.Build(), function, dst, value, size);
+}
+
 namespace {
 bool must_record_function_compilation(Isolate* isolate) {
   return isolate->logger()->is_logging_code_events() || isolate->is_profiling();
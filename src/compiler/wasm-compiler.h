@@ -379,6 +379,11 @@ class WasmGraphBuilder {
                  uint32_t alignment, uint32_t offset,
                  wasm::WasmCodePosition position);
 
+  Node* MemoryCopy(Node* dst, Node* src, Node* size,
+                   wasm::WasmCodePosition position);
+  Node* MemoryFill(Node* dst, Node* value, Node* size,
+                   wasm::WasmCodePosition position);
+
   bool has_simd() const { return has_simd_; }
 
   const wasm::WasmModule* module() { return env_ ? env_->module : nullptr; }
@@ -393,7 +398,6 @@ class WasmGraphBuilder {
   Node* wasm_context_ = nullptr;
   NodeVector signature_tables_;
   NodeVector function_tables_;
-  NodeVector function_table_sizes_;
   Node** control_ = nullptr;
   Node** effect_ = nullptr;
   Node** mem_size_ = nullptr;
@@ -422,6 +426,10 @@ class WasmGraphBuilder {
   Node* MemBuffer(uint32_t offset);
   void BoundsCheckMem(MachineType memtype, Node* index, uint32_t offset,
                       wasm::WasmCodePosition position);
+  // Traps unless [start, start + size) is within memory; returns the address
+  // of {start}.
+  Node* BoundsCheckMemRange(Node* start, Node* size,
+                            wasm::WasmCodePosition position);
   const Operator* GetSafeLoadOperator(int offset, wasm::ValueType type);
   const Operator* GetSafeStoreOperator(int offset, wasm::ValueType type);
   Node* BuildChangeEndiannessStore(Node* node, MachineType type,
@@ -2209,6 +2209,149 @@ CodeGenerator::CodeGenResult CodeGenerator::AssembleArchInstruction(
       }
       break;
     }
+    case kX64F32x4Splat: {
+      XMMRegister dst = i.OutputSimd128Register();
+      XMMRegister src = i.InputDoubleRegister(0);
+      if (dst != src) __ movss(dst, src);
+      __ shufps(dst, dst, 0x0);
+      break;
+    }
+    case kX64F32x4ExtractLane: {
+      // Only the low lane of a float32 register is meaningful, so the other
+      // lanes can be left with whatever pshufd puts there.
+      __ pshufd(i.OutputDoubleRegister(), i.InputSimd128Register(0),
+                i.InputInt8(1));
+      break;
+    }
+    case kX64F32x4ReplaceLane: {
+      CpuFeatureScope sse_scope(tasm(), SSE4_1);
+      __ insertps(i.OutputSimd128Register(), i.InputDoubleRegister(2),
+                  i.InputInt8(1) << 4);
+      break;
+    }
+    case kX64F32x4SConvertI32x4: {
+      __ cvtdq2ps(i.OutputSimd128Register(), i.InputSimd128Register(0));
+      break;
+    }
+    case kX64F32x4UConvertI32x4: {
+      XMMRegister dst = i.OutputSimd128Register();
+      XMMRegister src = i.InputSimd128Register(0);
+      if (dst != src) __ movaps(dst, src);
+      // Convert the low and high 16 bits separately; both conversions are
+      // exact, so only the final add rounds.
+      __ movaps(kScratchDoubleReg, dst);
+      __ pslld(kScratchDoubleReg, 16);
+      __ psrld(kScratchDoubleReg, 16);  // Low 16 bits.
+      __ psubd(dst, kScratchDoubleReg);  // High 16 bits.
+      __ cvtdq2ps(kScratchDoubleReg, kScratchDoubleReg);
+      __ psrld(dst, 1);  // Halve so the value fits in a signed int.
+      __ cvtdq2ps(dst, dst);
+      __ addps(dst, dst);
+      __ addps(dst, kScratchDoubleReg);
+      break;
+    }
+    case kX64F32x4Abs: {
+      XMMRegister dst = i.OutputSimd128Register();
+      XMMRegister src = i.InputSimd128Register(0);
+      if (dst == src) {
+        __ pcmpeqd(kScratchDoubleReg, kScratchDoubleReg);
+        __ psrld(kScratchDoubleReg, 1);
+        __ andps(dst, kScratchDoubleReg);
+      } else {
+        __ pcmpeqd(dst, dst);
+        __ psrld(dst, 1);
+        __ andps(dst, src);
+      }
+      break;
+    }
+    case kX64F32x4Neg: {
+      XMMRegister dst = i.OutputSimd128Register();
+      XMMRegister src = i.InputSimd128Register(0);
+      if (dst == src) {
+        __ pcmpeqd(kScratchDoubleReg, kScratchDoubleReg);
+        __ pslld(kScratchDoubleReg, 31);
+        __ xorps(dst, kScratchDoubleReg);
+      } else {
+        __ pcmpeqd(dst, dst);
+        __ pslld(dst, 31);
+        __ xorps(dst, src);
+      }
+      break;
+    }
+    case kX64F32x4RecipApprox: {
+      __ rcpps(i.OutputSimd128Register(), i.InputSimd128Register(0));
+      break;
+    }
+    case kX64F32x4RecipSqrtApprox: {
+      __ rsqrtps(i.OutputSimd128Register(), i.InputSimd128Register(0));
+      break;
+    }
+    case kX64F32x4Add: {
+      __ addps(i.OutputSimd128Register(), i.InputSimd128Register(1));
+      break;
+    }
+    case kX64F32x4AddHoriz: {
+      // Gather the even and odd lanes of both inputs, then add them; this
+      // avoids depending on SSE3 for haddps.
+      XMMRegister dst = i.OutputSimd128Register();
+      XMMRegister src = i.InputSimd128Register(1);
+      __ movaps(kScratchDoubleReg, dst);
+      __ shufps(kScratchDoubleReg, src, 0x88);
+      __ shufps(dst, src, 0xDD);
+      __ addps(dst, kScratchDoubleReg);
+      break;
+    }
+    case kX64F32x4Sub: {
+      __ subps(i.OutputSimd128Register(), i.InputSimd128Register(1));
+      break;
+    }
+    case kX64F32x4Mul: {
+      __ mulps(i.OutputSimd128Register(), i.InputSimd128Register(1));
+      break;
+    }
+    case kX64F32x4Min: {
+      // minps returns its second operand if either input is NaN or both are
+      // zero. Compute it in both orders and merge, which propagates NaNs and
+      // picks -0 over +0.
+      XMMRegister dst = i.OutputSimd128Register();
+      XMMRegister src = i.InputSimd128Register(1);
+      __ movaps(kScratchDoubleReg, src);
+      __ minps(kScratchDoubleReg, dst);
+      __ minps(dst, src);
+      __ orps(dst, kScratchDoubleReg);
+      break;
+    }
+    case kX64F32x4Max: {
+      // As for min, compute maxps in both orders. Where the results differ
+      // (NaN or zeros of different sign), subtracting the difference yields
+      // a NaN or +0 respectively.
+      XMMRegister dst = i.OutputSimd128Register();
+      XMMRegister src = i.InputSimd128Register(1);
+      __ movaps(kScratchDoubleReg, src);
+      __ maxps(kScratchDoubleReg, dst);
+      __ maxps(dst, src);
+      __ xorps(dst, kScratchDoubleReg);
+      __ orps(kScratchDoubleReg, dst);
+      __ subps(kScratchDoubleReg, dst);
+      __ movaps(dst, kScratchDoubleReg);
+      break;
+    }
+    case kX64F32x4Eq: {
+      __ cmpeqps(i.OutputSimd128Register(), i.InputSimd128Register(1));
+      break;
+    }
+    case kX64F32x4Ne: {
+      __ cmpneqps(i.OutputSimd128Register(), i.InputSimd128Register(1));
+      break;
+    }
+    case kX64F32x4Lt: {
+      __ cmpltps(i.OutputSimd128Register(), i.InputSimd128Register(1));
+      break;
+    }
+    case kX64F32x4Le: {
+      __ cmpleps(i.OutputSimd128Register(), i.InputSimd128Register(1));
+      break;
+    }
     case kX64I32x4Splat: {
       XMMRegister dst = i.OutputSimd128Register();
       __ movd(dst, i.InputRegister(0));
@@ -704,6 +704,7 @@ class RuntimeCallTimer final {
   V(RegExp_New)                                            \
   V(ScriptCompiler_Compile)                                \
   V(ScriptCompiler_CompileFunctionInContext)               \
+  V(ScriptCompiler_CompileModules)                         \
   V(ScriptCompiler_CompileUnbound)                         \
   V(Script_Run)                                            \
   V(Set_Add)                                               \
@@ -759,6 +760,7 @@ class RuntimeCallTimer final {
   V(CompileCodeLazy)                           \
   V(CompileDeserialize)                        \
   V(CompileEval)                               \
+  V(CompileFinalizeBackgroundCompile)          \
   V(CompileFullCode)                           \
   V(CompileAnalyse)                            \
   V(CompileBackgroundIgnition)                 \
@@ -1066,7 +1068,11 @@ class RuntimeCallTimerScope {
   HT(wasm_lazy_compilation_time, V8.WasmLazyCompilationMicroSeconds, 1000000,  \
      MICROSECOND)                                                              \
   HT(wasm_execution_time, V8.WasmExecutionTimeMicroSeconds, 10000000,          \
-     MICROSECOND)
+     MICROSECOND)                                                              \
+  HT(wasm_serialize_module_time, V8.WasmSerializeModuleMicroSeconds, 1000000,  \
+     MICROSECOND)                                                              \
+  HT(wasm_deserialize_module_time, V8.WasmDeserializeModuleMicroSeconds,       \
+     1000000, MICROSECOND)
 
 #define TIMED_HISTOGRAM_LIST(HT)                                               \
   HT(wasm_decode_asm_module_time, V8.WasmDecodeModuleMicroSeconds.asm,         \
@@ -1213,12 +1219,21 @@ class RuntimeCallTimerScope {
   SC(math_pow_runtime, V8.MathPowRuntime)                                      \
   SC(stack_interrupts, V8.StackInterrupts)                                     \
   SC(runtime_profiler_ticks, V8.RuntimeProfilerTicks)                          \
+  SC(runtime_profiler_baseline_candidates,                                     \
+     V8.RuntimeProfilerBaselineCandidates)                                     \
   SC(runtime_calls, V8.RuntimeCalls)                                           \
   SC(bounds_checks_eliminated, V8.BoundsChecksEliminated)                      \
   SC(bounds_checks_hoisted, V8.BoundsChecksHoisted)                            \
   SC(soft_deopts_requested, V8.SoftDeoptsRequested)                            \
   SC(soft_deopts_inserted, V8.SoftDeoptsInserted)                              \
   SC(soft_deopts_executed, V8.SoftDeoptsExecuted)                              \
+  /* Number of TurboFan compilations degraded by the optimization budget. */   \
+  SC(turbofan_budget_inlining_disabled, V8.TurboFanBudgetInliningDisabled)     \
+  SC(turbofan_budget_load_elimination_skipped,                                 \
+     V8.TurboFanBudgetLoadEliminationSkipped)                                  \
+  SC(turbofan_budget_escape_analysis_skipped,                                  \
+     V8.TurboFanBudgetEscapeAnalysisSkipped)                                   \
+  SC(turbofan_budget_aborted, V8.TurboFanBudgetAborted)                        \
   /* Number of write barriers in generated code. */                            \
   SC(write_barriers_dynamic, V8.WriteBarriersDynamic)                          \
   SC(write_barriers_static, V8.WriteBarriersStatic)                            \
@@ -1240,14 +1255,27 @@ class RuntimeCallTimerScope {
   /* Total code size (including metadata) of baseline code or bytecode. */     \
   SC(total_baseline_code_size, V8.TotalBaselineCodeSize)                       \
   /* Total count of functions compiled using the baseline compiler. */         \
-  SC(total_baseline_compile_count, V8.TotalBaselineCompileCount)
-
-#define STATS_COUNTER_TS_LIST(SC)                                    \
-  SC(wasm_generated_code_size, V8.WasmGeneratedCodeBytes)            \
-  SC(wasm_reloc_size, V8.WasmRelocBytes)                             \
-  SC(wasm_lazily_compiled_functions, V8.WasmLazilyCompiledFunctions) \
-  SC(liftoff_compiled_functions, V8.LiftoffCompiledFunctions)        \
-  SC(liftoff_unsupported_functions, V8.LiftoffUnsupportedFunctions)
+  SC(total_baseline_compile_count, V8.TotalBaselineCompileCount)               \
+  /* Functions enqueued on the compiler dispatcher by parser prediction. */    \
+  SC(compiler_dispatcher_predicted_jobs, V8.CompilerDispatcherPredictedJobs)   \
+  SC(compiler_dispatcher_predicted_ready, V8.CompilerDispatcherPredictedReady) \
+  SC(compiler_dispatcher_predicted_on_demand,                                  \
+     V8.CompilerDispatcherPredictedOnDemand)                                   \
+  SC(compiler_dispatcher_predicted_wasted, V8.CompilerDispatcherPredictedWasted)
+
+#define STATS_COUNTER_TS_LIST(SC)                                        \
+  SC(wasm_generated_code_size, V8.WasmGeneratedCodeBytes)                \
+  SC(wasm_reloc_size, V8.WasmRelocBytes)                                 \
+  SC(wasm_lazily_compiled_functions, V8.WasmLazilyCompiledFunctions)     \
+  SC(wasm_lazily_deserialized_functions,                                 \
+     V8.WasmLazilyDeserializedFunctions)                                 \
+  SC(wasm_streamed_units_committed, V8.WasmStreamedUnitsCommitted)       \
+  SC(liftoff_compiled_functions, V8.LiftoffCompiledFunctions)            \
+  SC(liftoff_unsupported_functions, V8.LiftoffUnsupportedFunctions)      \
+  SC(wasm_guard_regions_reserved, V8.WasmGuardRegionsReserved)           \
+  SC(wasm_guard_regions_reused, V8.WasmGuardRegionsReused)               \
+  SC(wasm_js_to_wasm_wrappers_compiled, V8.WasmJSToWasmWrappersCompiled) \
+  SC(wasm_js_to_wasm_wrappers_reused, V8.WasmJSToWasmWrappersReused)
 
 // This file contains all the v8 counters that are in use.
 class Counters : public std::enable_shared_from_this<Counters> {
@@ -957,6 +957,123 @@ bool Shell::ExecuteModule(Isolate* isolate, const char* file_name) {
   return true;
 }
 
+namespace {
+
+// Path of module |index| in the graph built by --module-graph-benchmark.
+std::string ModuleGraphBenchmarkPath(int index) {
+  return NormalizePath("module-graph-benchmark/" + std::to_string(index) +
+                           ".mjs",
+                       GetWorkingDirectory());
+}
+
+// Source of module |index| in the graph built by --module-graph-benchmark.
+// Every module imports up to two others, so the modules form a binary tree
+// rooted at module 0. |tag| keeps the sources of the two passes apart, so
+// that the second one does not hit the compilation cache.
+std::string ModuleGraphBenchmarkSource(int index, int module_count,
+                                       const char* tag) {
+  std::string id = std::to_string(index);
+  std::string source = std::string("// ") + tag + "\n";
+  std::string calls;
+  for (int child = 2 * index + 1;
+       child <= 2 * index + 2 && child < module_count; ++child) {
+    std::string child_id = std::to_string(child);
+    source += "import {f" + child_id + "} from './" + child_id + ".mjs';\n";
+    calls += "  if (n > 0) sum += f" + child_id + "(n - 1);\n";
+  }
+  source += "export function f" + id + "(n) {\n" +
+            "  let sum = " + id + ";\n" + calls +
+            "  for (let i = 0; i < n; i++) sum += i * " + id + ";\n" +
+            "  return sum;\n" +
+            "}\n";
+  source += "export class C" + id + " {\n" +
+            "  constructor(x) { this.x = x; }\n" +
+            "  get double() { return this.x * 2; }\n" +
+            "  add(y) { return new C" + id + "(this.x + y); }\n" +
+            "}\n";
+  return source;
+}
+
+}  // namespace
+
+bool Shell::RunModuleGraphBenchmark(Isolate* isolate, int module_count) {
+  HandleScope handle_scope(isolate);
+
+  PerIsolateData* data = PerIsolateData::Get(isolate);
+  Local<Context> realm = data->realms_[data->realm_current_].Get(isolate);
+  Context::Scope context_scope(realm);
+
+  TryCatch try_catch(isolate);
+  try_catch.SetVerbose(true);
+
+  // Set up the sources of both passes before taking any time.
+  const char* kTags[] = {"sequential", "batch"};
+  std::vector<std::unique_ptr<ScriptCompiler::Source>> sources[2];
+  for (int pass = 0; pass < 2; ++pass) {
+    for (int i = 0; i < module_count; ++i) {
+      std::string text =
+          ModuleGraphBenchmarkSource(i, module_count, kTags[pass]);
+      ScriptOrigin origin(
+          String::NewFromUtf8(isolate, ModuleGraphBenchmarkPath(i).c_str(),
+                              NewStringType::kNormal)
+              .ToLocalChecked(),
+          Local<Integer>(), Local<Integer>(), Local<Boolean>(),
+          Local<Integer>(), Local<Value>(), Local<Boolean>(),
+          Local<Boolean>(), True(isolate));
+      sources[pass].emplace_back(new ScriptCompiler::Source(
+          String::NewFromUtf8(isolate, text.c_str(), NewStringType::kNormal)
+              .ToLocalChecked(),
+          origin));
+    }
+  }
+
+  // One module at a time, like FetchModuleTree.
+  std::vector<Local<Module>> modules(module_count);
+  base::TimeTicks start = base::TimeTicks::HighResolutionNow();
+  for (int i = 0; i < module_count; ++i) {
+    if (!ScriptCompiler::CompileModule(isolate, sources[0][i].get())
+             .ToLocal(&modules[i])) {
+      ReportException(isolate, &try_catch);
+      return false;
+    }
+  }
+  base::TimeDelta sequential = base::TimeTicks::HighResolutionNow() - start;
+
+  // The whole graph at once.
+  std::vector<ScriptCompiler::Source*> batch;
+  for (auto& source : sources[1]) batch.push_back(source.get());
+  start = base::TimeTicks::HighResolutionNow();
+  if (ScriptCompiler::CompileModules(isolate, batch.size(), batch.data(),
+                                     modules.data())
+          .IsNothing()) {
+    ReportException(isolate, &try_catch);
+    return false;
+  }
+  base::TimeDelta batched = base::TimeTicks::HighResolutionNow() - start;
+
+  // Make sure the batch-compiled graph links and runs.
+  ModuleEmbedderData* d = GetModuleDataFromContext(realm);
+  for (int i = 0; i < module_count; ++i) {
+    std::string path = ModuleGraphBenchmarkPath(i);
+    d->specifier_to_module_map[path].Reset(isolate, modules[i]);
+    d->module_to_specifier_map[Global<Module>(isolate, modules[i])] = path;
+  }
+  Local<Value> result;
+  if (module_count > 0 &&
+      (!modules[0]
+            ->InstantiateModule(realm, ResolveModuleCallback)
+            .FromMaybe(false) ||
+       !modules[0]->Evaluate(realm).ToLocal(&result))) {
+    ReportException(isolate, &try_catch);
+    return false;
+  }
+
+  printf("Module graph of %d modules\n", module_count);
+  printf("  CompileModule:  %.3f ms\n", sequential.InMillisecondsF());
+  printf("  CompileModules: %.3f ms\n", batched.InMillisecondsF());
+  return true;
+}
+
 PerIsolateData::RealmScope::RealmScope(PerIsolateData* data) : data_(data) {
   data_->realm_count_ = 1;
   data_->realm_current_ = 0;
@@ -2803,6 +2920,14 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (strcmp(argv[i], "--enable-os-system") == 0) {
       options.enable_os_system = true;
       argv[i] = nullptr;
+    } else if (strcmp(argv[i], "--module-graph-benchmark") == 0) {
+      options.module_graph_benchmark = 2000;
+      options.script_executed = true;
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--module-graph-benchmark=", 25) == 0) {
+      options.module_graph_benchmark = atoi(argv[i] + 25);
+      options.script_executed = true;
+      argv[i] = nullptr;
     }
   }
 
@@ -2860,6 +2985,9 @@ int Shell::RunMain(Isolate* isolate, int argc, char* argv[], bool last_run) {
       InspectorClient inspector_client(context, options.enable_inspector);
       PerIsolateData::RealmScope realm_scope(PerIsolateData::Get(isolate));
       options.isolate_sources[0].Execute(isolate);
+      if (options.module_graph_benchmark > 0) {
+        RunModuleGraphBenchmark(isolate, options.module_graph_benchmark);
+      }
     }
     if (!use_existing_context) {
       DisposeModuleEmbedderData(context);
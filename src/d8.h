@@ -339,6 +339,7 @@ class ShellOptions {
   bool disable_in_process_stack_traces;
   int read_from_tcp_port;
   bool enable_os_system = false;
+  int module_graph_benchmark = 0;
 };
 
 class Shell : public i::AllStatic {
@@ -350,6 +351,7 @@ class Shell : public i::AllStatic {
                             Local<Value> name, bool print_result,
                             bool report_exceptions);
   static bool ExecuteModule(Isolate* isolate, const char* file_name);
+  static bool RunModuleGraphBenchmark(Isolate* isolate, int module_count);
   static void ReportException(Isolate* isolate, TryCatch* try_catch);
   static Local<String> ReadFile(Isolate* isolate, const char* name);
   static Local<Context> CreateEvaluationContext(Isolate* isolate);
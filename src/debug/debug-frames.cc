@@ -20,6 +20,7 @@ FrameInspector::FrameInspector(StandardFrame* frame, int inlined_frame_index,
   FrameSummary summary = FrameSummary::Get(frame, inlined_frame_index);
 
   is_constructor_ = summary.is_constructor();
+  summary.EnsureSourcePositionsAvailable();
   source_position_ = summary.SourcePosition();
   function_name_ = summary.FunctionName();
   script_ = Handle<Script>::cast(summary.script());
@@ -1305,6 +1305,8 @@ bool Debug::EnsureBreakInfo(Handle<SharedFunctionInfo> shared) {
       !Compiler::Compile(shared, Compiler::CLEAR_EXCEPTION)) {
     return false;
   }
+  // Break locations are derived from the source position table.
+  SharedFunctionInfo::EnsureSourcePositionsAvailable(shared);
   CreateBreakInfo(shared);
   return true;
 }
@@ -216,6 +216,10 @@ void ExternalReferenceTable::AddReferences(Isolate* isolate) {
       "wasm::word32_popcnt");
   Add(ExternalReference::wasm_word64_popcnt(isolate).address(),
       "wasm::word64_popcnt");
+  Add(ExternalReference::wasm_memory_copy(isolate).address(),
+      "wasm::memory_copy");
+  Add(ExternalReference::wasm_memory_fill(isolate).address(),
+      "wasm::memory_fill");
   // If the trap handler is not supported, the optimizer will remove these
   // runtime functions. In this case, the arm simulator will break if we add
   // them to the external reference table.
@@ -374,6 +374,9 @@ DEFINE_BOOL(turbo_sp_frame_access, false,
             "use stack pointer-relative access to frame wherever possible")
 DEFINE_BOOL(turbo_preprocess_ranges, true,
             "run pre-register allocation heuristics")
+DEFINE_BOOL(turbo_defer_cold_paths, true,
+            "move code that always ends in a deoptimization or a throw out "
+            "of line")
 DEFINE_STRING(turbo_filter, "*", "optimization filter for TurboFan compiler")
 DEFINE_BOOL(trace_turbo, false, "trace generated TurboFan IR")
 DEFINE_BOOL(trace_turbo_graph, false, "trace generated TurboFan graphs")
@@ -407,6 +410,17 @@ DEFINE_BOOL(trace_verify_csa, false, "trace code stubs verification")
 DEFINE_STRING(csa_trap_on_node, nullptr,
               "trigger break point when a node with given id is created in "
               "given stub. The format is: StubName,NodeId")
+DEFINE_INT(turbo_budget_graph_size, 500000,
+           "number of graph nodes after which TurboFan degrades optimizations "
+           "of a function (0 means unlimited)")
+DEFINE_INT(turbo_budget_zone_size, 256,
+           "zone memory in MB after which TurboFan degrades optimizations of "
+           "a function (0 means unlimited)")
+DEFINE_INT(turbo_budget_time, 2000,
+           "compilation time in ms after which TurboFan degrades optimizations "
+           "of a function (0 means unlimited)")
+DEFINE_BOOL(trace_turbo_budget, false,
+            "trace TurboFan's optimization budget decisions")
 DEFINE_BOOL(turbo_stats, false, "print TurboFan statistics")
 DEFINE_BOOL(turbo_stats_nvp, false,
             "print TurboFan statistics in machine-readable format")
@@ -524,6 +538,9 @@ DEFINE_BOOL(trace_asm_scanner, false,
             "log tokens encountered by asm.js scanner")
 DEFINE_BOOL(trace_asm_parser, false, "verbose logging of asm.js parse failures")
 DEFINE_BOOL(stress_validate_asm, false, "try to validate everything as asm.js")
+DEFINE_BOOL(concurrent_asm_translation, false,
+            "validate and translate asm.js modules on a background thread")
+DEFINE_IMPLICATION(concurrent_asm_translation, compiler_dispatcher)
 
 DEFINE_BOOL(dump_wasm_module, false, "dump wasm module bytes")
 DEFINE_STRING(dump_wasm_module_path, nullptr,
@@ -537,6 +554,8 @@ DEFINE_BOOL(experimental_wasm_mv, false,
             "enable prototype multi-value support for wasm")
 DEFINE_BOOL(experimental_wasm_threads, false,
             "enable prototype threads for wasm")
+DEFINE_BOOL(experimental_wasm_bulk_memory, false,
+            "enable prototype bulk memory opcodes for wasm")
 
 DEFINE_BOOL(wasm_opt, false, "enable wasm optimization")
 DEFINE_BOOL(wasm_no_bounds_checks, false,
@@ -547,6 +566,12 @@ DEFINE_BOOL(wasm_no_stack_checks, false,
 DEFINE_BOOL(wasm_trap_handler, false,
             "use signal handlers to catch out of bounds memory access in wasm"
             " (experimental, currently Linux x86_64 only)")
+DEFINE_INT(wasm_guard_region_pool_size, 4,
+           "number of released wasm guard regions kept for reuse by later "
+           "instances")
+DEFINE_BOOL(wasm_shared_wrapper_cache, true,
+            "share JS-to-wasm wrappers with identical signatures across "
+            "modules")
 DEFINE_BOOL(wasm_code_fuzzer_gen_test, false,
             "Generate a test case when running the wasm-code fuzzer")
 DEFINE_BOOL(print_wasm_code, false, "Print WebAssembly code")
@@ -560,6 +585,10 @@ DEFINE_BOOL(wasm_lazy_compilation, false,
 // wasm-interpret-all resets {asm-,}wasm-lazy-compilation.
 DEFINE_NEG_IMPLICATION(wasm_interpret_all, asm_wasm_lazy_compilation)
 DEFINE_NEG_IMPLICATION(wasm_interpret_all, wasm_lazy_compilation)
+DEFINE_BOOL(wasm_lazy_deserialization, false,
+            "serialize wasm functions separately and deserialize each of them "
+            "on its first call")
+DEFINE_NEG_IMPLICATION(wasm_interpret_all, wasm_lazy_deserialization)
 
 // Profiler flags.
 DEFINE_INT(frame_count, 1, "number of stack frames inspected by the profiler")
@@ -659,6 +688,10 @@ DEFINE_BOOL(verify_heap_skip_remembered_set, false,
             "disable remembered set verification")
 #endif
 DEFINE_BOOL(move_object_start, true, "enable moving of object starts")
+DEFINE_BOOL(flush_bytecode, false,
+            "flush the bytecode of functions that have not been executed "
+            "during the last few full GCs")
+DEFINE_BOOL(trace_flush_bytecode, false, "trace bytecode flushing")
 DEFINE_BOOL(memory_reducer, true, "use memory reducer")
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
@@ -762,10 +795,15 @@ DEFINE_BOOL(trace, false, "trace function calls")
 
 // codegen.cc
 DEFINE_BOOL(lazy, true, "use lazy compilation")
+DEFINE_BOOL(enable_lazy_source_positions, false,
+            "skip source positions when generating bytecode and collect them "
+            "on demand by recompiling the function")
 DEFINE_BOOL(trace_opt, false, "trace lazy optimization")
 DEFINE_BOOL(trace_opt_verbose, false, "extra verbose compilation tracing")
 DEFINE_IMPLICATION(trace_opt_verbose, trace_opt)
 DEFINE_BOOL(trace_opt_stats, false, "trace lazy optimization statistics")
+DEFINE_BOOL(trace_baseline_candidates, false,
+            "trace warm functions which are not yet marked for optimization")
 DEFINE_BOOL(trace_deopt, false, "trace optimize function deoptimization")
 DEFINE_BOOL(trace_file_names, false,
             "include file names in trace-opt/trace-deopt output")
@@ -790,6 +828,10 @@ DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 DEFINE_BOOL(compiler_dispatcher, false, "enable compiler dispatcher")
 DEFINE_BOOL(trace_compiler_dispatcher, false,
             "trace compiler dispatcher activity")
+DEFINE_BOOL(predictive_compile, false,
+            "compile lazy functions which the parser expects to be called "
+            "soon on the compiler dispatcher")
+DEFINE_IMPLICATION(predictive_compile, compiler_dispatcher)
 
 // compiler-dispatcher-job.cc
 DEFINE_BOOL(
@@ -885,6 +927,9 @@ DEFINE_IMPLICATION(aggressive_lazy_inner_functions, lazy_inner_functions)
 DEFINE_BOOL(preparser_scope_analysis, true,
             "perform scope analysis for preparsed inner functions")
 DEFINE_IMPLICATION(preparser_scope_analysis, aggressive_lazy_inner_functions)
+DEFINE_BOOL(background_compile, false,
+            "generate bytecode for streamed scripts on the background thread "
+            "which parses them")
 
 // simulator-arm.cc, simulator-arm64.cc and simulator-mips.cc
 DEFINE_BOOL(trace_sim, false, "Trace simulator execution")
@@ -1229,6 +1274,8 @@ DEFINE_BOOL(single_threaded, false, "disable the use of background tasks")
 DEFINE_IMPLICATION(single_threaded, single_threaded_gc)
 DEFINE_NEG_IMPLICATION(single_threaded, concurrent_recompilation)
 DEFINE_NEG_IMPLICATION(single_threaded, compiler_dispatcher)
+DEFINE_NEG_IMPLICATION(single_threaded, concurrent_asm_translation)
+DEFINE_NEG_IMPLICATION(single_threaded, predictive_compile)
 
 //
 // Parallel and concurrent GC (Orinoco) related flags.
@@ -1157,6 +1157,14 @@ bool FrameSummary::JavaScriptFrameSummary::is_subject_to_debugging() const {
   return function()->shared()->IsSubjectToDebugging();
 }
 
+void FrameSummary::JavaScriptFrameSummary::EnsureSourcePositionsAvailable()
+    const {
+  // Optimized code took its positions from the bytecode when it was built, see
+  // PipelineCompilationJob::PrepareJobImpl.
+  SharedFunctionInfo::EnsureSourcePositionsAvailable(
+      handle(function()->shared(), isolate()));
+}
+
 int FrameSummary::JavaScriptFrameSummary::SourcePosition() const {
   return abstract_code()->SourcePosition(code_offset());
 }
@@ -1321,6 +1329,10 @@ FRAME_SUMMARY_DISPATCH(Handle<Context>, native_context)
 
 #undef FRAME_SUMMARY_DISPATCH
 
+void FrameSummary::EnsureSourcePositionsAvailable() const {
+  if (IsJavaScript()) AsJavaScript().EnsureSourcePositionsAvailable();
+}
+
 void OptimizedFrame::Summarize(std::vector<FrameSummary>* frames) const {
   DCHECK(frames->empty());
   DCHECK(is_optimized());
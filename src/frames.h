@@ -488,6 +488,7 @@ class FrameSummary BASE_EMBEDDED {
     int code_offset() const { return code_offset_; }
     bool is_constructor() const { return is_constructor_; }
     bool is_subject_to_debugging() const;
+    void EnsureSourcePositionsAvailable() const;
     int SourcePosition() const;
     int SourceStatementPosition() const;
     Handle<Object> script() const;
@@ -577,6 +578,11 @@ class FrameSummary BASE_EMBEDDED {
   Handle<String> FunctionName() const;
   Handle<Context> native_context() const;
 
+  // Source positions of bytecode may be collected lazily, see
+  // --enable-lazy-source-positions. Call this before SourcePosition() if the
+  // position is going to be exposed.
+  void EnsureSourcePositionsAvailable() const;
+
 #define FRAME_SUMMARY_CAST(kind_, type, field, desc)      \
   bool Is##desc() const { return base_.kind() == kind_; } \
   const type& As##desc() const {                          \
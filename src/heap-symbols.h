@@ -286,6 +286,7 @@
   F(HEAP_PROLOGUE)                                   \
   F(MC_CLEAR)                                        \
   F(MC_CLEAR_DEPENDENT_CODE)                         \
+  F(MC_CLEAR_FLUSHED_BYTECODE)                       \
   F(MC_CLEAR_MAPS)                                   \
   F(MC_CLEAR_SLOTS_BUFFER)                           \
   F(MC_CLEAR_STORE_BUFFER)                           \
@@ -233,6 +233,12 @@ class ConcurrentMarkingVisitor final
   }
 
   int VisitJSFunction(Map* map, JSFunction* object) {
+    // Closures that may have to be reset after bytecode flushing are
+    // recorded by the main thread.
+    if (FLAG_flush_bytecode) {
+      bailout_.Push(object);
+      return 0;
+    }
     if (!ShouldVisit(object)) return 0;
     int size = JSFunction::BodyDescriptorWeak::SizeOf(map, object);
     VisitMapPointer(object, object->map_slot());
@@ -240,6 +246,15 @@ class ConcurrentMarkingVisitor final
     return size;
   }
 
+  int VisitSharedFunctionInfo(Map* map, SharedFunctionInfo* object) {
+    // Old bytecode is held weakly by the main thread marking visitor.
+    if (FLAG_flush_bytecode) {
+      bailout_.Push(object);
+      return 0;
+    }
+    return BaseClass::VisitSharedFunctionInfo(map, object);
+  }
+
   int VisitMap(Map* meta_map, Map* map) {
     if (marking_state_.IsGrey(map)) {
       // Maps have ad-hoc weakness for descriptor arrays. They also clear the
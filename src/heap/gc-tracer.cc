@@ -587,6 +587,7 @@ void GCTracer::PrintNVP() const {
           "heap.external.weak_global_handles=%.1f "
           "clear=%1.f "
           "clear.dependent_code=%.1f "
+          "clear.flushed_bytecode=%.1f "
           "clear.maps=%.1f "
           "clear.slots_buffer=%.1f "
           "clear.store_buffer=%.1f "
@@ -675,6 +676,7 @@ void GCTracer::PrintNVP() const {
           current_.scopes[Scope::HEAP_EXTERNAL_WEAK_GLOBAL_HANDLES],
           current_.scopes[Scope::MC_CLEAR],
           current_.scopes[Scope::MC_CLEAR_DEPENDENT_CODE],
+          current_.scopes[Scope::MC_CLEAR_FLUSHED_BYTECODE],
           current_.scopes[Scope::MC_CLEAR_MAPS],
           current_.scopes[Scope::MC_CLEAR_SLOTS_BUFFER],
           current_.scopes[Scope::MC_CLEAR_STORE_BUFFER],
@@ -189,6 +189,7 @@ Heap::Heap()
       inline_allocation_disabled_(false),
       tracer_(nullptr),
       promoted_objects_size_(0),
+      flushed_bytecode_size_(0),
       promotion_ratio_(0),
       semi_space_copied_object_size_(0),
       previous_semi_space_copied_object_size_(0),
@@ -1983,6 +1984,7 @@ void Heap::Scavenge() {
       &UpdateNewSpaceReferenceInExternalStringTableEntry);
 
   incremental_marking()->UpdateMarkingWorklistAfterScavenge();
+  mark_compact_collector()->UpdateFlushedJSFunctionsAfterScavenge();
 
   if (FLAG_concurrent_marking) {
     // Ensure that concurrent marker does not track pages that are
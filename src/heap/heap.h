@@ -1366,6 +1366,13 @@ class Heap {
   }
   inline size_t promoted_objects_size() { return promoted_objects_size_; }
 
+  // Total size of the bytecode arrays dropped by --flush-bytecode.
+  inline size_t flushed_bytecode_size() { return flushed_bytecode_size_; }
+
+  inline void IncrementFlushedBytecodeSize(size_t bytecode_size) {
+    flushed_bytecode_size_ += bytecode_size;
+  }
+
   inline void IncrementSemiSpaceCopiedObjectSize(size_t object_size) {
     semi_space_copied_object_size_ += object_size;
   }
@@ -2323,6 +2330,7 @@ class Heap {
   GCTracer* tracer_;
 
   size_t promoted_objects_size_;
+  size_t flushed_bytecode_size_;
   double promotion_ratio_;
   double promotion_rate_;
   size_t semi_space_copied_object_size_;
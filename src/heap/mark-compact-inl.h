@@ -82,6 +82,12 @@ int MarkingVisitor<fixed_array_mode, retaining_path_mode,
                                                   JSFunction* object) {
   int size = JSFunction::BodyDescriptorWeak::SizeOf(map, object);
   JSFunction::BodyDescriptorWeak::IterateBody(object, size, this);
+  // Closures entering the interpreter have to be reset if the bytecode of
+  // their function is flushed.
+  if (object->code()->is_interpreter_trampoline_builtin() &&
+      collector_->IsBytecodeFlushingCandidate(object->shared())) {
+    collector_->AddFlushedJSFunction(object);
+  }
   return size;
 }
 
@@ -139,6 +145,30 @@ int MarkingVisitor<fixed_array_mode, retaining_path_mode,
   return size;
 }
 
+template <FixedArrayVisitationMode fixed_array_mode,
+          TraceRetainingPathMode retaining_path_mode, typename MarkingState>
+int MarkingVisitor<fixed_array_mode, retaining_path_mode, MarkingState>::
+    VisitSharedFunctionInfo(Map* map, SharedFunctionInfo* shared) {
+  int size = SharedFunctionInfo::BodyDescriptor::SizeOf(map, shared);
+  if (!collector_->IsBytecodeFlushingCandidate(shared)) {
+    SharedFunctionInfo::BodyDescriptor::IterateBody(shared, size, this);
+    return size;
+  }
+  // Skip the old bytecode in the function data field. The slot is recorded
+  // when the candidate is processed, see MarkCompactCollector::FlushBytecode.
+  const int kFunctionDataEndOffset =
+      SharedFunctionInfo::kFunctionDataOffset + kPointerSize;
+  VisitPointers(shared,
+                HeapObject::RawField(shared, SharedFunctionInfo::kCodeOffset),
+                HeapObject::RawField(shared,
+                                     SharedFunctionInfo::kFunctionDataOffset));
+  VisitPointers(shared, HeapObject::RawField(shared, kFunctionDataEndOffset),
+                HeapObject::RawField(
+                    shared, SharedFunctionInfo::kEndOfPointerFieldsOffset));
+  collector_->AddBytecodeFlushingCandidate(shared);
+  return size;
+}
+
 template <FixedArrayVisitationMode fixed_array_mode,
           TraceRetainingPathMode retaining_path_mode, typename MarkingState>
 int MarkingVisitor<fixed_array_mode, retaining_path_mode,
@@ -351,6 +381,12 @@ void MarkCompactCollector::MarkExternallyReferencedObject(HeapObject* obj) {
   }
 }
 
+bool MarkCompactCollector::IsBytecodeFlushingCandidate(
+    SharedFunctionInfo* shared) {
+  return FLAG_flush_bytecode && !bytecode_flushing_disabled_ &&
+         shared->CanFlushBytecode();
+}
+
 void MarkCompactCollector::RecordSlot(HeapObject* object, Object** slot,
                                       Object* target) {
   Page* target_page = Page::FromAddress(reinterpret_cast<Address>(target));
@@ -9,6 +9,8 @@
 #include "src/cancelable-task.h"
 #include "src/code-stubs.h"
 #include "src/compilation-cache.h"
+#include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
+#include "src/debug/debug.h"
 #include "src/deoptimizer.h"
 #include "src/execution.h"
 #include "src/frames-inl.h"
@@ -458,6 +460,7 @@ MarkCompactCollector::MarkCompactCollector(Heap* heap)
       compacting_(false),
       black_allocation_(false),
       have_code_to_deoptimize_(false),
+      bytecode_flushing_disabled_(false),
       marking_worklist_(heap),
       sweeper_(heap, non_atomic_marking_state()) {
   old_to_new_slots_ = -1;
@@ -2342,6 +2345,7 @@ void MinorMarkCompactCollector::CollectGarbage() {
   {
     TRACE_GC(heap()->tracer(), GCTracer::Scope::MINOR_MC_MARKING_DEQUE);
     heap()->incremental_marking()->UpdateMarkingWorklistAfterScavenge();
+    heap()->mark_compact_collector()->UpdateFlushedJSFunctionsAfterScavenge();
   }
 
   {
@@ -2512,6 +2516,8 @@ void MarkCompactCollector::MarkLiveObjects() {
   state_ = MARK_LIVE_OBJECTS;
 #endif
 
+  RetainBytecodeOfFlushingCandidates();
+
   heap_->local_embedder_heap_tracer()->EnterFinalPause();
 
   RootMarkingVisitor root_visitor(this);
@@ -2629,8 +2635,108 @@ void MarkCompactCollector::ClearNonLiveReferences() {
 
   ClearWeakCollections();
 
+  FlushBytecode();
+
   DCHECK(weak_objects_.weak_cells.IsGlobalEmpty());
   DCHECK(weak_objects_.transition_arrays.IsGlobalEmpty());
+  DCHECK(weak_objects_.bytecode_flushing_candidates.IsGlobalEmpty());
+  DCHECK(weak_objects_.flushed_js_functions.IsGlobalEmpty());
+}
+
+void MarkCompactCollector::RetainBytecodeOfFlushingCandidates() {
+  if (!FLAG_flush_bytecode) return;
+  // The debugger, precise coverage and type profiles attach state to the
+  // bytecode and the feedback vectors that has to stay in place. Queued
+  // optimization jobs may inline functions that are not referenced from any
+  // deoptimization data yet.
+  bytecode_flushing_disabled_ =
+      isolate()->debug()->is_active() ||
+      !isolate()->is_best_effort_code_coverage() ||
+      isolate()->is_collecting_type_profile() ||
+      (isolate()->concurrent_recompilation_enabled() &&
+       isolate()->optimizing_compile_dispatcher()->HasJobs());
+  weak_objects_.bytecode_flushing_candidates.Update(
+      [this](SharedFunctionInfo* shared, SharedFunctionInfo** out) -> bool {
+        // The function may have been executed or debugged since it was
+        // visited.
+        if (!bytecode_flushing_disabled_ && shared->CanFlushBytecode()) {
+          *out = shared;
+          return true;
+        }
+        if (shared->HasBytecodeArray()) {
+          Object** slot = HeapObject::RawField(
+              shared, SharedFunctionInfo::kFunctionDataOffset);
+          HeapObject* bytecode = HeapObject::cast(*slot);
+          MarkObject(shared, bytecode);
+          RecordSlot(shared, slot, bytecode);
+        }
+        return false;
+      });
+}
+
+void MarkCompactCollector::FlushBytecode() {
+  if (!FLAG_flush_bytecode) return;
+  TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_CLEAR_FLUSHED_BYTECODE);
+  size_t flushed_count = 0;
+  size_t flushed_size = 0;
+  SharedFunctionInfo* shared;
+  while (weak_objects_.bytecode_flushing_candidates.Pop(kMainThread, &shared)) {
+    // The same function may have been visited more than once.
+    if (!shared->HasBytecodeArray()) continue;
+    Object** slot =
+        HeapObject::RawField(shared, SharedFunctionInfo::kFunctionDataOffset);
+    BytecodeArray* bytecode = BytecodeArray::cast(*slot);
+    if (non_atomic_marking_state()->IsBlackOrGrey(bytecode)) {
+      // The bytecode is still reachable, e.g. from an activation on the stack
+      // or from the deoptimization data of optimized code.
+      RecordSlot(shared, slot, bytecode);
+      continue;
+    }
+    flushed_size += bytecode->SizeIncludingMetadata();
+    shared->FlushBytecode();
+    // We record the slot manually because marking is finished at this point
+    // and the write barrier would bailout.
+    slot = HeapObject::RawField(shared, SharedFunctionInfo::kCodeOffset);
+    RecordSlot(shared, slot, *slot);
+    flushed_count++;
+  }
+
+  // Closures that were called before still point to the interpreter entry
+  // trampoline, send them through CompileLazy again.
+  Code* compile_lazy = isolate()->builtins()->builtin(Builtins::kCompileLazy);
+  JSFunction* function;
+  while (weak_objects_.flushed_js_functions.Pop(kMainThread, &function)) {
+    if (function->shared()->HasBytecodeArray()) continue;
+    if (!function->code()->is_interpreter_trampoline_builtin()) continue;
+    function->set_code_no_write_barrier(compile_lazy);
+    Object** slot = HeapObject::RawField(function, JSFunction::kCodeOffset);
+    RecordSlot(function, slot, compile_lazy);
+  }
+  bytecode_flushing_disabled_ = false;
+
+  if (flushed_count == 0) return;
+  heap()->IncrementFlushedBytecodeSize(flushed_size);
+  if (FLAG_trace_flush_bytecode) {
+    PrintIsolate(isolate(),
+                 "Flushed bytecode of %" PRIuS " functions, %" PRIuS
+                 " KB (%" PRIuS " KB total)\n",
+                 flushed_count, flushed_size / KB,
+                 heap()->flushed_bytecode_size() / KB);
+  }
+}
+
+void MarkCompactCollector::UpdateFlushedJSFunctionsAfterScavenge() {
+  weak_objects_.flushed_js_functions.Update(
+      [this](JSFunction* function, JSFunction** out) -> bool {
+        if (!heap()->InFromSpace(function)) {
+          *out = function;
+          return true;
+        }
+        MapWord map_word = function->map_word();
+        if (!map_word.IsForwardingAddress()) return false;
+        *out = JSFunction::cast(map_word.ToForwardingAddress());
+        return true;
+      });
 }
 
 
@@ -2967,6 +3073,8 @@ void MarkCompactCollector::ClearWeakCellsAndSimpleMapTransitions(
 void MarkCompactCollector::AbortWeakObjects() {
   weak_objects_.weak_cells.Clear();
   weak_objects_.transition_arrays.Clear();
+  weak_objects_.bytecode_flushing_candidates.Clear();
+  weak_objects_.flushed_js_functions.Clear();
 }
 
 void MarkCompactCollector::RecordRelocSlot(Code* host, RelocInfo* rinfo,
@@ -494,6 +494,11 @@ class MajorNonAtomicMarkingState final
 struct WeakObjects {
   Worklist<WeakCell*, 64> weak_cells;
   Worklist<TransitionArray*, 64> transition_arrays;
+  // Functions whose old bytecode is only held weakly, and closures which
+  // have to be reset if that bytecode is flushed. Only the main thread adds
+  // to these, see MarkCompactCollector::FlushBytecode.
+  Worklist<SharedFunctionInfo*, 64> bytecode_flushing_candidates;
+  Worklist<JSFunction*, 64> flushed_js_functions;
 };
 
 // Collector for young and old generation.
@@ -822,6 +827,22 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
     weak_objects_.transition_arrays.Push(kMainThread, array);
   }
 
+  // Returns true if the marking visitors should hold the bytecode of
+  // {shared} weakly, so that it can be flushed if nothing else retains it.
+  V8_INLINE bool IsBytecodeFlushingCandidate(SharedFunctionInfo* shared);
+
+  void AddBytecodeFlushingCandidate(SharedFunctionInfo* shared) {
+    weak_objects_.bytecode_flushing_candidates.Push(kMainThread, shared);
+  }
+
+  void AddFlushedJSFunction(JSFunction* function) {
+    weak_objects_.flushed_js_functions.Push(kMainThread, function);
+  }
+
+  // Drops entries of functions in from-space which did not survive a
+  // scavenge during incremental marking, and forwards the others.
+  void UpdateFlushedJSFunctionsAfterScavenge();
+
   Sweeper& sweeper() { return sweeper_; }
 
 #ifdef DEBUG
@@ -884,6 +905,12 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   //      implicit references' groups, or embedder heap tracing.
   void ProcessEphemeralMarking(bool only_process_harmony_weak_collections);
 
+  // Called at the start of the atomic pause. Bytecode that was found to be old
+  // during incremental marking is marked after all if it has been executed
+  // since, or if flushing is not possible in this GC. In the latter case the
+  // marking visitors hold all bytecode strongly for the rest of the pause.
+  void RetainBytecodeOfFlushingCandidates();
+
   // If the call-site of the top optimized code was not prepared for
   // deoptimization, then treat embedded pointers in the code as strong as
   // otherwise they can die and try to deoptimize the underlying code.
@@ -940,6 +967,11 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
       DependentCode** dependent_code_list);
   void AbortWeakObjects();
 
+  // Flushes the bytecode of candidates whose bytecode array has not been
+  // marked, and resets their closures to the lazy compile state. Only the
+  // bytecode that is actually freed is counted.
+  void FlushBytecode();
+
   // Starts sweeping of spaces by contributing on the main thread and setting
   // up other pages for sweeping. Does not start sweeper tasks.
   void StartSweepSpaces();
@@ -996,6 +1028,10 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
 
   bool have_code_to_deoptimize_;
 
+  // True while the marking visitors have to hold all bytecode strongly, see
+  // RetainBytecodeOfFlushingCandidates.
+  bool bytecode_flushing_disabled_;
+
   MarkingWorklist marking_worklist_;
   WeakObjects weak_objects_;
 
@@ -1041,6 +1077,7 @@ class MarkingVisitor final
   V8_INLINE int VisitJSWeakCollection(Map* map, JSWeakCollection* object);
   V8_INLINE int VisitMap(Map* map, Map* object);
   V8_INLINE int VisitNativeContext(Map* map, Context* object);
+  V8_INLINE int VisitSharedFunctionInfo(Map* map, SharedFunctionInfo* object);
   V8_INLINE int VisitTransitionArray(Map* map, TransitionArray* object);
   V8_INLINE int VisitWeakCell(Map* map, WeakCell* object);
 
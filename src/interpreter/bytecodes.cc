@@ -267,6 +267,8 @@ bool Bytecodes::IsStarLookahead(Bytecode bytecode, OperandScale operand_scale) {
       case Bytecode::kAdd:
       case Bytecode::kSub:
       case Bytecode::kMul:
+      case Bytecode::kDiv:
+      case Bytecode::kMod:
       case Bytecode::kAddSmi:
       case Bytecode::kSubSmi:
       case Bytecode::kInc:
@@ -281,8 +283,13 @@ bool Bytecodes::IsStarLookahead(Bytecode bytecode, OperandScale operand_scale) {
       case Bytecode::kCallUndefinedReceiver0:
       case Bytecode::kCallUndefinedReceiver1:
       case Bytecode::kCallUndefinedReceiver2:
+      case Bytecode::kCallRuntime:
       case Bytecode::kConstruct:
       case Bytecode::kConstructWithSpread:
+      case Bytecode::kCreateClosure:
+      case Bytecode::kCreateArrayLiteral:
+      case Bytecode::kCreateEmptyArrayLiteral:
+      case Bytecode::kCreateEmptyObjectLiteral:
         return true;
       default:
         return false;
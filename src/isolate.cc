@@ -54,6 +54,7 @@
 #include "src/visitors.h"
 #include "src/vm-state-inl.h"
 #include "src/wasm/compilation-manager.h"
+#include "src/wasm/wasm-memory.h"
 #include "src/wasm/wasm-objects.h"
 #include "src/zone/accounting-allocator.h"
 
@@ -404,6 +405,10 @@ class FrameArrayBuilder {
         // Filter out internal frames that we do not want to show.
         if (!IsVisibleInStackTrace(summary.function())) continue;
 
+        // Positions are only resolved when the trace is formatted, and may
+        // not have been collected for this function yet.
+        summary.EnsureSourcePositionsAvailable();
+
         Handle<AbstractCode> abstract_code = summary.abstract_code();
         const int offset = summary.code_offset();
 
@@ -811,6 +816,7 @@ Handle<FixedArray> Isolate::CaptureCurrentStackTrace(
       if (!(options & StackTrace::kExposeFramesAcrossSecurityOrigins) &&
           !this->context()->HasSameSecurityTokenAs(*frame.native_context()))
         continue;
+      frame.EnsureSourcePositionsAvailable();
       Handle<StackFrameInfo> new_frame_obj = helper.NewStackFrameObject(frame);
       stack_trace_elems->set(frames_seen, *new_frame_obj);
       frames_seen++;
@@ -1604,6 +1610,7 @@ bool Isolate::ComputeLocation(MessageLocation* target) {
   frames.reserve(FLAG_max_inlining_levels + 1);
   frame->Summarize(&frames);
   FrameSummary& summary = frames.back();
+  summary.EnsureSourcePositionsAvailable();
   int pos = summary.SourcePosition();
   Handle<SharedFunctionInfo> shared;
   Handle<Object> script = summary.script();
@@ -2406,6 +2413,8 @@ Isolate::Isolate(bool enable_serializer)
       basic_block_profiler_(nullptr),
       cancelable_task_manager_(new CancelableTaskManager()),
       wasm_compilation_manager_(new wasm::CompilationManager()),
+      wasm_guard_region_pool_(new wasm::GuardRegionPool()),
+      wasm_wrapper_templates_(new wasm::JSToWasmWrapperTemplates(allocator_)),
       abort_on_uncaught_exception_callback_(nullptr),
       total_regexp_code_generated_(0) {
   {
@@ -2555,6 +2564,9 @@ void Isolate::Deinit() {
   cancelable_task_manager()->CancelAndWait();
 
   heap_.TearDown();
+  // Dead array buffers may have returned their guard regions while the heap
+  // was torn down.
+  wasm_guard_region_pool_->TearDown(array_buffer_allocator());
   logger_->TearDown();
 
   delete interpreter_;
@@ -2655,6 +2667,10 @@ Isolate::~Isolate() {
   delete cancelable_task_manager_;
   cancelable_task_manager_ = nullptr;
 
+  // The wrapper templates allocate from {allocator_}. Their code handles went
+  // away with {global_handles_}.
+  wasm_wrapper_templates_.reset();
+
   delete allocator_;
   allocator_ = nullptr;
 
@@ -110,6 +110,8 @@ class Interpreter;
 
 namespace wasm {
 class CompilationManager;
+class GuardRegionPool;
+class JSToWasmWrapperTemplates;
 }
 
 #define RETURN_FAILURE_IF_SCHEDULED_EXCEPTION(isolate) \
@@ -445,6 +447,8 @@ typedef std::vector<HeapObject*> DebugObjectCache;
   V(bool, is_profiling, false)                                                \
   /* true if a trace is being formatted through Error.prepareStackTrace. */   \
   V(bool, formatting_stack_trace, false)                                      \
+  /* true while source positions are collected for lazily compiled code. */   \
+  V(bool, collecting_source_positions, false)                                 \
   /* Perform side effect checks on function call and API callbacks. */        \
   V(bool, needs_side_effect_check, false)                                     \
   /* Current code coverage mode */                                            \
@@ -1253,6 +1257,14 @@ class Isolate {
     return wasm_compilation_manager_.get();
   }
 
+  wasm::GuardRegionPool* wasm_guard_region_pool() {
+    return wasm_guard_region_pool_.get();
+  }
+
+  wasm::JSToWasmWrapperTemplates* wasm_wrapper_templates() {
+    return wasm_wrapper_templates_.get();
+  }
+
   const AstStringConstants* ast_string_constants() const {
     return ast_string_constants_;
   }
@@ -1623,6 +1635,8 @@ class Isolate {
   CancelableTaskManager* cancelable_task_manager_;
 
   std::unique_ptr<wasm::CompilationManager> wasm_compilation_manager_;
+  std::unique_ptr<wasm::GuardRegionPool> wasm_guard_region_pool_;
+  std::unique_ptr<wasm::JSToWasmWrapperTemplates> wasm_wrapper_templates_;
 
   debug::ConsoleDelegate* console_delegate_ = nullptr;
 
@@ -1584,6 +1584,7 @@ void Logger::LogCompiledFunctions() {
   for (int i = 0; i < compiled_funcs_count; ++i) {
     if (code_objects[i].is_identical_to(BUILTIN_CODE(isolate_, CompileLazy)))
       continue;
+    SharedFunctionInfo::EnsureSourcePositionsAvailable(sfis[i]);
     LogExistingFunction(sfis[i], code_objects[i]);
   }
 }
@@ -72,6 +72,7 @@
 #include "src/string-stream.h"
 #include "src/unicode-cache-inl.h"
 #include "src/utils-inl.h"
+#include "src/wasm/wasm-memory.h"
 #include "src/wasm/wasm-objects.h"
 #include "src/zone/zone.h"
 
@@ -14597,6 +14598,39 @@ bool BytecodeArray::IsOld() const {
   return bytecode_age() >= kIsOldBytecodeAge;
 }
 
+bool SharedFunctionInfo::CanFlushBytecode() {
+  if (!IsInterpreted() || !HasBytecodeArray()) return false;
+  if (!bytecode_array()->IsOld()) return false;
+  // Top-level code is never compiled lazily, and resumable functions may have
+  // suspended activations that are not on any stack.
+  if (is_toplevel() || IsResumableFunction(kind())) return false;
+  if (!IsUserJavaScript() || HasDebugInfo()) return false;
+  return Script::cast(script())->source()->IsString();
+}
+
+void SharedFunctionInfo::FlushBytecode() {
+  DCHECK(CanFlushBytecode());
+  if (FLAG_trace_flush_bytecode) {
+    OFStream os(stdout);
+    os << "[flushing bytecode of " << Brief(this) << "]" << std::endl;
+  }
+  ClearBytecodeArray();
+  set_code(GetIsolate()->builtins()->builtin(Builtins::kCompileLazy));
+}
+
+// static
+void SharedFunctionInfo::EnsureSourcePositionsAvailable(
+    Handle<SharedFunctionInfo> shared_info) {
+  if (!shared_info->has_lazy_source_positions()) return;
+  if (!shared_info->HasBytecodeArray()) return;
+  Isolate* isolate = shared_info->GetIsolate();
+  // Callers may be in the middle of throwing, or in a scope that forbids
+  // compilation. Source positions then simply stay unavailable.
+  if (isolate->has_pending_exception()) return;
+  if (!AllowCompilation::IsAllowed(isolate)) return;
+  Compiler::CollectSourcePositions(shared_info);
+}
+
 // static
 void JSArray::Initialize(Handle<JSArray> array, int capacity, int length) {
   DCHECK_GE(capacity, 0);
@@ -18815,7 +18849,15 @@ void JSArrayBuffer::FreeBackingStore() {
   using AllocationMode = ArrayBuffer::Allocator::AllocationMode;
   const size_t length = allocation_length();
   const AllocationMode mode = allocation_mode();
-  GetIsolate()->array_buffer_allocator()->Free(allocation_base(), length, mode);
+  Isolate* isolate = GetIsolate();
+  v8::ArrayBuffer::Allocator* allocator = isolate->array_buffer_allocator();
+  // Guard regions are expensive to reserve, so hand them back to the wasm
+  // pool for reuse by the next instance if there is room.
+  const bool pooled =
+      has_guard_region() && mode == AllocationMode::kReservation &&
+      isolate->wasm_guard_region_pool()->TryReturn(
+          allocator, allocation_base(), length, NumberToSize(byte_length()));
+  if (!pooled) allocator->Free(allocation_base(), length, mode);
 
   // Zero out the backing store and allocation base to avoid dangling
   // pointers.
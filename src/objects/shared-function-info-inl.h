@@ -189,6 +189,12 @@ BIT_FIELD_ACCESSORS(SharedFunctionInfo, debugger_hints,
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, debugger_hints,
                     has_reported_binary_coverage,
                     SharedFunctionInfo::HasReportedBinaryCoverageBit)
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, debugger_hints,
+                    has_lazy_source_positions,
+                    SharedFunctionInfo::HasLazySourcePositionsBit)
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, debugger_hints,
+                    needs_eager_source_positions,
+                    SharedFunctionInfo::NeedsEagerSourcePositionsBit)
 
 void SharedFunctionInfo::DontAdaptArguments() {
   DCHECK(code()->kind() == Code::BUILTIN || code()->kind() == Code::STUB);
@@ -205,7 +211,7 @@ Code* SharedFunctionInfo::code() const {
 void SharedFunctionInfo::set_code(Code* value, WriteBarrierMode mode) {
   DCHECK(value->kind() != Code::OPTIMIZED_FUNCTION);
   // If the SharedFunctionInfo has bytecode we should never mark it for lazy
-  // compile, since the bytecode is never flushed.
+  // compile, bytecode flushing clears the bytecode first.
   DCHECK(value != GetIsolate()->builtins()->builtin(Builtins::kCompileLazy) ||
          !HasBytecodeArray());
   WRITE_FIELD(this, kCodeOffset, value);
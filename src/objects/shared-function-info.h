@@ -154,6 +154,14 @@ class SharedFunctionInfo : public HeapObject {
   inline BytecodeArray* bytecode_array() const;
   inline void set_bytecode_array(BytecodeArray* bytecode);
   inline void ClearBytecodeArray();
+
+  // Returns true if the bytecode has aged enough to be dropped, and the
+  // function can later be recompiled lazily from its source.
+  bool CanFlushBytecode();
+  // Drops the bytecode and puts the function back into the lazy compile
+  // state. Closures still pointing at the interpreter entry trampoline have to
+  // be reset by the caller.
+  void FlushBytecode();
   inline bool HasAsmWasmData() const;
   inline FixedArray* asm_wasm_data() const;
   inline void set_asm_wasm_data(FixedArray* data);
@@ -251,6 +259,20 @@ class SharedFunctionInfo : public HeapObject {
   // Indicates that the function has been reported for binary code coverage.
   DECL_BOOLEAN_ACCESSORS(has_reported_binary_coverage)
 
+  // Indicates that the bytecode was generated without source positions, see
+  // --enable-lazy-source-positions.
+  DECL_BOOLEAN_ACCESSORS(has_lazy_source_positions)
+
+  // Indicates that source positions could not be collected for bytecode that
+  // was generated without them. Recompilation records them eagerly.
+  DECL_BOOLEAN_ACCESSORS(needs_eager_source_positions)
+
+  // Attaches the source position table to bytecode that was generated without
+  // one. Needs to be called before source positions of the bytecode are read
+  // for stack traces, the debugger or the profiler.
+  static void EnsureSourcePositionsAvailable(
+      Handle<SharedFunctionInfo> shared_info);
+
   // The function's name if it is non-empty, otherwise the inferred name.
   String* DebugName();
 
@@ -492,7 +514,9 @@ class SharedFunctionInfo : public HeapObject {
   V(ComputedHasNoSideEffectBit, bool, 1, _)    \
   V(DebugIsBlackboxedBit, bool, 1, _)          \
   V(ComputedDebugIsBlackboxedBit, bool, 1, _)  \
-  V(HasReportedBinaryCoverageBit, bool, 1, _)
+  V(HasReportedBinaryCoverageBit, bool, 1, _)  \
+  V(HasLazySourcePositionsBit, bool, 1, _)     \
+  V(NeedsEagerSourcePositionsBit, bool, 1, _)
 
   DEFINE_BIT_FIELDS(DEBUGGER_HINTS_BIT_FIELDS)
 #undef DEBUGGER_HINTS_BIT_FIELDS
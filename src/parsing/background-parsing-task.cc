@@ -13,6 +13,10 @@ namespace v8 {
 namespace internal {
 
 void StreamedSource::Release() {
+  // The compilation jobs refer to {info}.
+  failed_asm_jobs.clear();
+  inner_function_jobs.clear();
+  outer_function_job.reset();
   parser.reset();
   info.reset();
 }
@@ -20,7 +24,11 @@ void StreamedSource::Release() {
 BackgroundParsingTask::BackgroundParsingTask(
     StreamedSource* source, ScriptCompiler::CompileOptions options,
     int stack_size, Isolate* isolate)
-    : source_(source), stack_size_(stack_size), script_data_(nullptr) {
+    : source_(source),
+      stack_size_(stack_size),
+      script_data_(nullptr),
+      isolate_(isolate),
+      main_thread_id_(ThreadId::Current()) {
   // We don't set the context to the CompilationInfo yet, because the background
   // thread cannot do anything with it anyway. We set it just before compilation
   // on the foreground thread.
@@ -41,6 +49,7 @@ BackgroundParsingTask::BackgroundParsingTask(
     info->set_runtime_call_stats(nullptr);
   }
   info->set_toplevel();
+  if (source->is_module) info->set_module();
   std::unique_ptr<Utf16CharacterStream> stream(
       ScannerStream::For(source->source_stream.get(), source->encoding,
                          info->runtime_call_stats()));
@@ -68,12 +77,28 @@ void BackgroundParsingTask::Run() {
   DisallowHandleDereference no_deref;
 
   // Reset the stack limit of the parser to reflect correctly that we're on a
-  // background thread.
-  uintptr_t stack_limit = GetCurrentStackPosition() - stack_size_ * KB;
+  // background thread. The main thread may run the task as well, see
+  // ScriptCompiler::CompileModules, and has used part of its stack already.
+  uintptr_t stack_limit =
+      ThreadId::Current().Equals(main_thread_id_)
+          ? isolate_->stack_guard()->real_climit()
+          : GetCurrentStackPosition() - stack_size_ * KB;
   source_->parser->set_stack_limit(stack_limit);
 
   source_->parser->ParseOnBackground(source_->info.get());
 
+  if ((FLAG_background_compile || source_->compile_on_background) &&
+      source_->info->literal() != nullptr) {
+    // Parsing has succeeded, so generate bytecode here as well. The compile
+    // jobs pick up the background thread's stack limit from the ParseInfo.
+    source_->info->set_stack_limit(stack_limit);
+    source_->compiled_on_background = true;
+    source_->outer_function_job.reset(
+        Compiler::CompileTopLevelOnBackgroundThread(
+            source_->info.get(), isolate_, &source_->inner_function_jobs,
+            &source_->failed_asm_jobs));
+  }
+
   if (script_data_ != nullptr) {
     source_->cached_data.reset(new ScriptCompiler::CachedData(
         script_data_->data(), script_data_->length(),
@@ -10,6 +10,7 @@
 #include "include/v8.h"
 #include "src/base/platform/platform.h"
 #include "src/base/platform/semaphore.h"
+#include "src/compiler.h"
 #include "src/parsing/parse-info.h"
 #include "src/unicode-cache.h"
 
@@ -34,6 +35,12 @@ struct StreamedSource {
   ScriptCompiler::StreamedSource::Encoding encoding;
   std::unique_ptr<ScriptCompiler::CachedData> cached_data;
 
+  // Parse the source as an ES module, see ScriptCompiler::CompileModules.
+  bool is_module = false;
+  // Generate bytecode on the background thread even without
+  // --background-compile, see ScriptCompiler::CompileModules.
+  bool compile_on_background = false;
+
   // Data needed for parsing, and data needed to to be passed between thread
   // between parsing and compilation. These need to be initialized before the
   // compilation starts.
@@ -41,6 +48,16 @@ struct StreamedSource {
   std::unique_ptr<ParseInfo> info;
   std::unique_ptr<Parser> parser;
 
+  // Compilation jobs for the top-level code and eager inner functions, if they
+  // were prepared and executed on the background thread. Only finalization is
+  // left for the main thread then.
+  bool compiled_on_background = false;
+  std::unique_ptr<CompilationJob> outer_function_job;
+  CompilationJobList inner_function_jobs;
+  // asm.js jobs which failed validation, their functions were compiled to
+  // bytecode instead. The failures are reported on the main thread.
+  CompilationJobList failed_asm_jobs;
+
   // Prevent copying.
   StreamedSource(const StreamedSource&) = delete;
   StreamedSource& operator=(const StreamedSource&) = delete;
@@ -58,6 +75,9 @@ class BackgroundParsingTask : public ScriptCompiler::ScriptStreamingTask {
   StreamedSource* source_;  // Not owned.
   int stack_size_;
   ScriptData* script_data_;
+  Isolate* isolate_;
+  // The thread that created the task, which may also run it.
+  ThreadId main_thread_id_;
 };
 }  // namespace internal
 }  // namespace v8
@@ -722,6 +722,9 @@ FunctionLiteral* Parser::DoParseProgram(ParseInfo* info) {
     if (ok) {
       CheckConflictingVarDeclarations(scope, &ok);
     }
+    if (ok && FLAG_predictive_compile && !info->is_eval()) {
+      MarkPredictedFunctions(scope, body);
+    }
 
     if (ok && info->parse_restriction() == ONLY_SINGLE_FUNCTION_LITERAL) {
       if (body->length() != 1 ||
@@ -3361,6 +3364,55 @@ void Parser::InsertShadowingVarBindingInitializers(Block* inner_block) {
   }
 }
 
+namespace {
+
+// Records the name of the callee if {expr} is a call of a free variable, or an
+// assignment of such a call (this also covers variable initializers).
+void CollectTopLevelCallee(Expression* expr,
+                           ZoneList<const AstRawString*>* callees,
+                           Zone* zone) {
+  if (expr->IsAssignment()) expr = expr->AsAssignment()->value();
+  if (!expr->IsCall()) return;
+  Expression* callee = expr->AsCall()->expression();
+  if (!callee->IsVariableProxy()) return;
+  callees->Add(callee->AsVariableProxy()->raw_name(), zone);
+}
+
+}  // namespace
+
+void Parser::MarkPredictedFunctions(DeclarationScope* scope,
+                                    ZoneList<Statement*>* body) {
+  ZoneList<const AstRawString*> callees(4, zone());
+  for (int i = 0; i < body->length(); ++i) {
+    Statement* statement = body->at(i);
+    if (statement->IsExpressionStatement()) {
+      CollectTopLevelCallee(statement->AsExpressionStatement()->expression(),
+                            &callees, zone());
+    } else if (statement->IsBlock()) {
+      // Variable declarations with initializers are desugared into blocks.
+      ZoneList<Statement*>* statements = statement->AsBlock()->statements();
+      for (int j = 0; j < statements->length(); ++j) {
+        if (!statements->at(j)->IsExpressionStatement()) continue;
+        CollectTopLevelCallee(
+            statements->at(j)->AsExpressionStatement()->expression(), &callees,
+            zone());
+      }
+    }
+  }
+  if (callees.is_empty()) return;
+
+  // AstRawStrings are internalized by the AstValueFactory, so names can be
+  // compared by identity.
+  for (Declaration* decl : *scope->declarations()) {
+    if (!decl->IsFunctionDeclaration()) continue;
+    FunctionLiteral* fun = decl->AsFunctionDeclaration()->fun();
+    if (fun->ShouldEagerCompile()) continue;
+    if (callees.Contains(decl->proxy()->raw_name())) {
+      fun->set_should_compile_in_background();
+    }
+  }
+}
+
 void Parser::InsertSloppyBlockFunctionVarBindings(DeclarationScope* scope) {
   // For the outermost eval scope, we cannot hoist during parsing: let
   // declarations in the surrounding scope may prevent hoisting, but the
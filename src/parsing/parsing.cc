@@ -51,7 +51,7 @@ bool ParseProgram(ParseInfo* info, Isolate* isolate) {
 }
 
 bool ParseFunction(ParseInfo* info, Handle<SharedFunctionInfo> shared_info,
-                   Isolate* isolate) {
+                   Isolate* isolate, ReportErrorsAndStatisticsMode mode) {
   DCHECK(!info->is_toplevel());
   DCHECK(!shared_info.is_null());
   DCHECK_NULL(info->literal());
@@ -74,13 +74,16 @@ bool ParseFunction(ParseInfo* info, Handle<SharedFunctionInfo> shared_info,
 
   result = parser.ParseFunction(isolate, info, shared_info);
   info->set_literal(result);
-  if (result == nullptr) {
-    info->pending_error_handler()->ReportErrors(isolate, info->script(),
-                                                info->ast_value_factory());
-  } else {
+  if (result != nullptr) {
     result->scope()->AttachOuterScopeInfo(info, isolate);
   }
-  parser.UpdateStatistics(isolate, info->script());
+  if (mode == ReportErrorsAndStatisticsMode::kYes) {
+    if (result == nullptr) {
+      info->pending_error_handler()->ReportErrors(isolate, info->script(),
+                                                  info->ast_value_factory());
+    }
+    parser.UpdateStatistics(isolate, info->script());
+  }
   return (result != nullptr);
 }
 
@@ -15,16 +15,19 @@ class SharedFunctionInfo;
 
 namespace parsing {
 
+enum class ReportErrorsAndStatisticsMode { kYes, kNo };
+
 // Parses the top-level source code represented by the parse info and sets its
 // function literal.  Returns false (and deallocates any allocated AST
 // nodes) if parsing failed.
 V8_EXPORT_PRIVATE bool ParseProgram(ParseInfo* info, Isolate* isolate);
 
 // Like ParseProgram but for an individual function which already has a
-// allocated shared function info.
-V8_EXPORT_PRIVATE bool ParseFunction(ParseInfo* info,
-                                     Handle<SharedFunctionInfo> shared_info,
-                                     Isolate* isolate);
+// allocated shared function info. With ReportErrorsAndStatisticsMode::kNo a
+// failed parse leaves no exception pending, and no statistics are recorded.
+V8_EXPORT_PRIVATE bool ParseFunction(
+    ParseInfo* info, Handle<SharedFunctionInfo> shared_info, Isolate* isolate,
+    ReportErrorsAndStatisticsMode mode = ReportErrorsAndStatisticsMode::kYes);
 
 // If you don't know whether info->is_toplevel() is true or not, use this method
 // to dispatch to either of the above functions. Prefer to use the above methods
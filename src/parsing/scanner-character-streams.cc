@@ -17,6 +17,15 @@ namespace internal {
 
 namespace {
 const unibrow::uchar kUtf8Bom = 0xfeff;
+
+// Returns the number of leading ASCII bytes in [data, data + length), checking
+// a word at a time.
+size_t AsciiPrefixLength(const uint8_t* data, size_t length) {
+  DCHECK_LE(length, static_cast<size_t>(kMaxInt));
+  return static_cast<size_t>(
+      String::NonAsciiStart(reinterpret_cast<const char*>(data),
+                            static_cast<int>(length)));
+}
 }  // namespace
 
 // ----------------------------------------------------------------------------
@@ -273,6 +282,14 @@ bool Utf8ExternalStreamingStream::SkipToPosition(size_t position) {
   size_t it = current_.pos.bytes - chunk.start.bytes;
   size_t chars = chunk.start.chars;
   while (it < chunk.length && chars < position) {
+    if (incomplete_char == unibrow::Utf8::Utf8IncrementalBuffer(0)) {
+      // ASCII bytes map 1:1 to chars, so runs of them can be skipped at once.
+      size_t ascii = AsciiPrefixLength(
+          chunk.data + it, Min(chunk.length - it, position - chars));
+      it += ascii;
+      chars += ascii;
+      if (it == chunk.length || chars == position) break;
+    }
     unibrow::uchar t =
         unibrow::Utf8::ValueOfIncremental(chunk.data[it], &incomplete_char);
     if (t == kUtf8Bom && current_.pos.chars == 0) {
@@ -323,6 +340,19 @@ void Utf8ExternalStreamingStream::FillBufferFromCurrentChunk() {
   size_t it;
   for (it = current_.pos.bytes - chunk.start.bytes;
        it < chunk.length && cursor + 1 < buffer_start_ + kBufferSize; it++) {
+    if (incomplete_char == unibrow::Utf8::Utf8IncrementalBuffer(0)) {
+      // Widen runs of ASCII bytes directly instead of decoding them one by
+      // one. Most UTF-8 sources are (almost) entirely ASCII.
+      size_t capacity = buffer_start_ + kBufferSize - 1 - cursor;
+      size_t ascii = AsciiPrefixLength(chunk.data + it,
+                                       Min(chunk.length - it, capacity));
+      CopyChars(cursor, chunk.data + it, ascii);
+      cursor += ascii;
+      it += ascii;
+      if (it == chunk.length || cursor + 1 >= buffer_start_ + kBufferSize) {
+        break;
+      }
+    }
     unibrow::uchar t =
         unibrow::Utf8::ValueOfIncremental(chunk.data[it], &incomplete_char);
     if (t == unibrow::Utf8::kIncomplete) continue;
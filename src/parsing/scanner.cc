@@ -12,6 +12,7 @@
 
 #include "src/ast/ast-value-factory.h"
 #include "src/char-predicates-inl.h"
+#include "src/base/once.h"
 #include "src/conversions-inl.h"
 #include "src/parsing/duplicate-finder.h"  // For Scanner::FindSymbol
 #include "src/unicode-cache-inl.h"
@@ -506,16 +507,13 @@ Token::Value Scanner::SkipSingleHTMLComment() {
 }
 
 Token::Value Scanner::SkipSingleLineComment() {
-  Advance();
-
   // The line terminator at the end of the line is not considered
   // to be part of the single-line comment; it is recognized
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
-  while (c0_ != kEndOfInput && !IsLineTerminator(c0_)) {
-    Advance();
-  }
+  c0_ = source_->AdvanceUntil(
+      [](uc32 c0) { return unibrow::IsLineTerminator(c0); });
 
   return Token::WHITESPACE;
 }
@@ -523,8 +521,9 @@ Token::Value Scanner::SkipSingleLineComment() {
 
 Token::Value Scanner::SkipSourceURLComment() {
   TryToParseSourceURLComment();
-  while (c0_ != kEndOfInput && !IsLineTerminator(c0_)) {
-    Advance();
+  if (c0_ != kEndOfInput && !IsLineTerminator(c0_)) {
+    c0_ = source_->AdvanceUntil(
+        [](uc32 c0) { return unibrow::IsLineTerminator(c0); });
   }
 
   return Token::WHITESPACE;
@@ -1062,21 +1061,22 @@ Token::Value Scanner::ScanString() {
   Advance<false, false>();  // consume quote
 
   LiteralScope literal(this);
-  while (true) {
-    if (c0_ > kMaxAscii) {
-      HandleLeadSurrogate();
-      break;
-    }
-    if (c0_ == kEndOfInput || c0_ == '\n' || c0_ == '\r') return Token::ILLEGAL;
-    if (c0_ == quote) {
-      literal.Complete();
-      Advance<false, false>();
-      return Token::STRING;
-    }
-    char c = static_cast<char>(c0_);
-    if (c == '\\') break;
+  // Fast path: collect plain ASCII characters straight from the buffer up to
+  // the closing quote, an escape or anything that needs special handling.
+  auto is_plain_char = [this, quote](uc32 c) {
+    return IsInRange(c, 0, kMaxAscii) && c != quote && c != '\\' &&
+           c != '\n' && c != '\r';
+  };
+  if (is_plain_char(c0_)) AddLiteralCharsWhile(is_plain_char);
+  if (c0_ == quote) {
+    literal.Complete();
     Advance<false, false>();
-    AddLiteralChar(c);
+    return Token::STRING;
+  }
+  if (c0_ > kMaxAscii) {
+    HandleLeadSurrogate();
+  } else if (c0_ == kEndOfInput || c0_ == '\n' || c0_ == '\r') {
+    return Token::ILLEGAL;
   }
 
   while (c0_ != quote && c0_ != kEndOfInput && !IsLineTerminator(c0_)) {
@@ -1401,6 +1401,8 @@ uc32 Scanner::ScanUnicodeEscape() {
 // ----------------------------------------------------------------------------
 // Keyword Matcher
 
+// The list of keywords, grouped by their first character. Run
+// tools/gen-keywords-table.py after changing it.
 #define KEYWORDS(KEYWORD_GROUP, KEYWORD)                    \
   KEYWORD_GROUP('a')                                        \
   KEYWORD("arguments", Token::ARGUMENTS)                    \
@@ -1487,43 +1489,230 @@ uc32 Scanner::ScanUnicodeEscape() {
   KEYWORD_GROUP('_')                                        \
   KEYWORD("__proto__", Token::PROTO_UNDERSCORED)
 
+// Keywords are matched with a perfect hash over the length, the first two and
+// the last character, followed by a single string comparison. The tables are
+// generated from the KEYWORDS list above by tools/gen-keywords-table.py.
+struct KeywordTableEntry {
+  const char* keyword;
+  int length;
+  Token::Value token;
+};
+
+// BEGIN GENERATED KEYWORD TABLE
+// Generated by tools/gen-keywords-table.py, do not edit.
+static const int kKeywordTableSize = 128;
+
+static const uint8_t kKeywordHashValues[128] = {
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   8,
+      0,   3, 122, 122, 124, 103,   9,  73,
+     91,  47,   0,  24,  29,  37,  24,  39,
+     88,   0, 126, 122,  13,  37,  19,  51,
+     52,  47,   0,   0,   0,   0,   0,   0,
+};
+
+static const KeywordTableEntry kKeywordTable[] = {
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"return", 6, Token::RETURN},
+    {"arguments", 9, Token::ARGUMENTS},
+    {"", 0, Token::IDENTIFIER},
+    {"name", 4, Token::NAME},
+    {"static", 6, Token::STATIC},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"switch", 6, Token::SWITCH},
+    {"", 0, Token::IDENTIFIER},
+    {"continue", 8, Token::CONTINUE},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"meta", 4, Token::META},
+    {"let", 3, Token::LET},
+    {"break", 5, Token::BREAK},
+    {"class", 5, Token::CLASS},
+    {"var", 3, Token::VAR},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"eval", 4, Token::EVAL},
+    {"extends", 7, Token::EXTENDS},
+    {"", 0, Token::IDENTIFIER},
+    {"anonymous", 9, Token::ANONYMOUS},
+    {"", 0, Token::IDENTIFIER},
+    {"throw", 5, Token::THROW},
+    {"__proto__", 9, Token::PROTO_UNDERSCORED},
+    {"super", 5, Token::SUPER},
+    {"target", 6, Token::TARGET},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"enum", 4, Token::ENUM},
+    {"", 0, Token::IDENTIFIER},
+    {"constructor", 11, Token::CONSTRUCTOR},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"export", 6, Token::EXPORT},
+    {"", 0, Token::IDENTIFIER},
+    {"from", 4, Token::FROM},
+    {"for", 3, Token::FOR},
+    {"", 0, Token::IDENTIFIER},
+    {"const", 5, Token::CONST},
+    {"", 0, Token::IDENTIFIER},
+    {"new", 3, Token::NEW},
+    {"", 0, Token::IDENTIFIER},
+    {"interface", 9, Token::FUTURE_STRICT_RESERVED_WORD},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"void", 4, Token::VOID},
+    {"of", 2, Token::OF},
+    {"", 0, Token::IDENTIFIER},
+    {"try", 3, Token::TRY},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"get", 3, Token::GET},
+    {"with", 4, Token::WITH},
+    {"undefined", 9, Token::UNDEFINED},
+    {"if", 2, Token::IF},
+    {"private", 7, Token::FUTURE_STRICT_RESERVED_WORD},
+    {"", 0, Token::IDENTIFIER},
+    {"prototype", 9, Token::PROTOTYPE},
+    {"", 0, Token::IDENTIFIER},
+    {"await", 5, Token::AWAIT},
+    {"package", 7, Token::FUTURE_STRICT_RESERVED_WORD},
+    {"", 0, Token::IDENTIFIER},
+    {"typeof", 6, Token::TYPEOF},
+    {"do", 2, Token::DO},
+    {"", 0, Token::IDENTIFIER},
+    {"function", 8, Token::FUNCTION},
+    {"", 0, Token::IDENTIFIER},
+    {"delete", 6, Token::DELETE},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"implements", 10, Token::FUTURE_STRICT_RESERVED_WORD},
+    {"", 0, Token::IDENTIFIER},
+    {"instanceof", 10, Token::INSTANCEOF},
+    {"protected", 9, Token::FUTURE_STRICT_RESERVED_WORD},
+    {"", 0, Token::IDENTIFIER},
+    {"catch", 5, Token::CATCH},
+    {"null", 4, Token::NULL_LITERAL},
+    {"yield", 5, Token::YIELD},
+    {"", 0, Token::IDENTIFIER},
+    {"in", 2, Token::IN},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"this", 4, Token::THIS},
+    {"import", 6, Token::IMPORT},
+    {"case", 4, Token::CASE},
+    {"debugger", 8, Token::DEBUGGER},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"finally", 7, Token::FINALLY},
+    {"else", 4, Token::ELSE},
+    {"", 0, Token::IDENTIFIER},
+    {"set", 3, Token::SET},
+    {"sent", 4, Token::SENT},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+    {"true", 4, Token::TRUE_LITERAL},
+    {"default", 7, Token::DEFAULT},
+    {"false", 5, Token::FALSE_LITERAL},
+    {"as", 2, Token::AS},
+    {"while", 5, Token::WHILE},
+    {"", 0, Token::IDENTIFIER},
+    {"async", 5, Token::ASYNC},
+    {"public", 6, Token::FUTURE_STRICT_RESERVED_WORD},
+    {"", 0, Token::IDENTIFIER},
+    {"", 0, Token::IDENTIFIER},
+};
+// END GENERATED KEYWORD TABLE
+
+static const int kMinKeywordLength = 2;
+static const int kMaxKeywordLength = 11;
+
+static inline int KeywordHash(const uint8_t* input, int input_length) {
+  // Characters outside of ASCII never occur in keywords, so folding them into
+  // the table can only produce mismatches which the comparison rejects.
+  int hash = input_length + kKeywordHashValues[input[0] & 0x7F] +
+             kKeywordHashValues[input[1] & 0x7F] +
+             kKeywordHashValues[input[input_length - 1] & 0x7F];
+  return hash & (kKeywordTableSize - 1);
+}
+
+#ifdef DEBUG
+// Checks that the generated table is in sync with the KEYWORDS list, i.e. that
+// every keyword hashes to its own slot with the right token and that the table
+// holds no other keywords.
+static void VerifyKeywordTable() {
+  int keyword_count = 0;
+#define KEYWORD_GROUP_CHECK(ch)
+#define KEYWORD_CHECK(string, token_value)                                 \
+  {                                                                        \
+    const int length = static_cast<int>(arraysize(string) - 1);            \
+    CHECK_LE(kMinKeywordLength, length);                                   \
+    CHECK_GE(kMaxKeywordLength, length);                                   \
+    const KeywordTableEntry& entry = kKeywordTable[KeywordHash(            \
+        reinterpret_cast<const uint8_t*>(string), length)];                \
+    CHECK_EQ(length, entry.length);                                        \
+    CHECK_EQ(0, memcmp(string, entry.keyword, length));                    \
+    CHECK_EQ(token_value, entry.token);                                    \
+    keyword_count++;                                                       \
+  }
+  KEYWORDS(KEYWORD_GROUP_CHECK, KEYWORD_CHECK)
+#undef KEYWORD_CHECK
+#undef KEYWORD_GROUP_CHECK
+  int entry_count = 0;
+  for (const KeywordTableEntry& entry : kKeywordTable) {
+    if (entry.length != 0) entry_count++;
+  }
+  CHECK_EQ(keyword_count, entry_count);
+}
+
+static base::OnceType verify_keyword_table_once = V8_ONCE_INIT;
+#endif  // DEBUG
+
 static Token::Value KeywordOrIdentifierToken(const uint8_t* input,
                                              int input_length) {
   DCHECK_GE(input_length, 1);
-  const int kMinLength = 2;
-  const int kMaxLength = 11;
-  if (input_length < kMinLength || input_length > kMaxLength) {
+#ifdef DEBUG
+  base::CallOnce(&verify_keyword_table_once, &VerifyKeywordTable);
+#endif
+  if (input_length < kMinKeywordLength || input_length > kMaxKeywordLength) {
     return Token::IDENTIFIER;
   }
-  switch (input[0]) {
-    default:
-#define KEYWORD_GROUP_CASE(ch)                                \
-      break;                                                  \
-    case ch:
-#define KEYWORD(keyword, token)                                           \
-  {                                                                       \
-    /* 'keyword' is a char array, so sizeof(keyword) is */                \
-    /* strlen(keyword) plus 1 for the NUL char. */                        \
-    const int keyword_length = sizeof(keyword) - 1;                       \
-    STATIC_ASSERT(keyword_length >= kMinLength);                          \
-    STATIC_ASSERT(keyword_length <= kMaxLength);                          \
-    DCHECK_EQ(input[0], keyword[0]);                                      \
-    DCHECK(token == Token::FUTURE_STRICT_RESERVED_WORD ||                 \
-           0 == strncmp(keyword, Token::String(token), sizeof(keyword))); \
-    if (input_length == keyword_length && input[1] == keyword[1] &&       \
-        (keyword_length <= 2 || input[2] == keyword[2]) &&                \
-        (keyword_length <= 3 || input[3] == keyword[3]) &&                \
-        (keyword_length <= 4 || input[4] == keyword[4]) &&                \
-        (keyword_length <= 5 || input[5] == keyword[5]) &&                \
-        (keyword_length <= 6 || input[6] == keyword[6]) &&                \
-        (keyword_length <= 7 || input[7] == keyword[7]) &&                \
-        (keyword_length <= 8 || input[8] == keyword[8]) &&                \
-        (keyword_length <= 9 || input[9] == keyword[9]) &&                \
-        (keyword_length <= 10 || input[10] == keyword[10])) {             \
-      return token;                                                       \
-    }                                                                     \
-  }
-      KEYWORDS(KEYWORD_GROUP_CASE, KEYWORD)
+  const KeywordTableEntry& entry =
+      kKeywordTable[KeywordHash(input, input_length)];
+  if (entry.length == input_length &&
+      memcmp(entry.keyword, input, input_length) == 0) {
+    DCHECK(entry.token == Token::FUTURE_STRICT_RESERVED_WORD ||
+           0 == strcmp(entry.keyword, Token::String(entry.token)));
+    return entry.token;
   }
   return Token::IDENTIFIER;
 }
@@ -1533,23 +1722,13 @@ Token::Value Scanner::ScanIdentifierOrKeyword() {
   DCHECK(unicode_cache_->IsIdentifierStart(c0_));
   LiteralScope literal(this);
   if (IsInRange(c0_, 'a', 'z') || c0_ == '_') {
-    do {
-      char first_char = static_cast<char>(c0_);
-      Advance<false, false>();
-      AddLiteralChar(first_char);
-    } while (IsInRange(c0_, 'a', 'z') || c0_ == '_');
+    AddLiteralCharsWhile(
+        [](uc32 c) { return IsInRange(c, 'a', 'z') || c == '_'; });
 
     if (IsDecimalDigit(c0_) || IsInRange(c0_, 'A', 'Z') || c0_ == '_' ||
         c0_ == '$') {
       // Identifier starting with lowercase.
-      char first_char = static_cast<char>(c0_);
-      Advance<false, false>();
-      AddLiteralChar(first_char);
-      while (IsAsciiIdentifier(c0_)) {
-        char first_char = static_cast<char>(c0_);
-        Advance<false, false>();
-        AddLiteralChar(first_char);
-      }
+      AddLiteralCharsWhile([](uc32 c) { return IsAsciiIdentifier(c); });
       if (c0_ <= kMaxAscii && c0_ != '\\') {
         literal.Complete();
         return Token::IDENTIFIER;
@@ -1568,11 +1747,7 @@ Token::Value Scanner::ScanIdentifierOrKeyword() {
 
     HandleLeadSurrogate();
   } else if (IsInRange(c0_, 'A', 'Z') || c0_ == '_' || c0_ == '$') {
-    do {
-      char first_char = static_cast<char>(c0_);
-      Advance<false, false>();
-      AddLiteralChar(first_char);
-    } while (IsAsciiIdentifier(c0_));
+    AddLiteralCharsWhile([](uc32 c) { return IsAsciiIdentifier(c); });
 
     if (c0_ <= kMaxAscii && c0_ != '\\') {
       literal.Complete();
@@ -7,6 +7,8 @@
 #ifndef V8_PARSING_SCANNER_H_
 #define V8_PARSING_SCANNER_H_
 
+#include <algorithm>
+
 #include "src/allocation.h"
 #include "src/base/logging.h"
 #include "src/char-predicates.h"
@@ -55,6 +57,31 @@ class Utf16CharacterStream {
     }
   }
 
+  // Returns and advances past the first code unit for which {check} returns
+  // true, skipping over all code units before it. This is equivalent to
+  // calling Advance() until {check} succeeds, but scans the buffer directly
+  // instead of paying the per code unit overhead of Advance(). Returns
+  // kEndOfInput if the input ends first.
+  template <typename FunctionType>
+  V8_INLINE uc32 AdvanceUntil(FunctionType check) {
+    while (true) {
+      const uint16_t* next_cursor_pos =
+          std::find_if(buffer_cursor_, buffer_end_, [&check](uint16_t raw_c0) {
+            return check(static_cast<uc32>(raw_c0));
+          });
+      if (next_cursor_pos != buffer_end_) {
+        buffer_cursor_ = next_cursor_pos + 1;
+        return static_cast<uc32>(*next_cursor_pos);
+      }
+      buffer_cursor_ = buffer_end_;
+      if (!ReadBlockChecked()) {
+        // See Advance() for why the cursor is moved past the end.
+        buffer_cursor_++;
+        return kEndOfInput;
+      }
+    }
+  }
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -596,6 +623,20 @@ class Scanner {
     if (check_surrogate) HandleLeadSurrogate();
   }
 
+  // Adds c0_ and all following characters for which {predicate} returns true
+  // to the current literal, taking them directly from the stream's buffer.
+  // The predicate must only accept one-byte characters.
+  template <typename FunctionType>
+  V8_INLINE void AddLiteralCharsWhile(FunctionType predicate) {
+    DCHECK(predicate(c0_));
+    AddLiteralChar(static_cast<char>(c0_));
+    c0_ = source_->AdvanceUntil([this, &predicate](uc32 c) {
+      if (!predicate(c)) return true;
+      AddLiteralChar(static_cast<char>(c));
+      return false;
+    });
+  }
+
   void HandleLeadSurrogate() {
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
       uc32 c1 = source_->Advance();
@@ -112,6 +112,16 @@ void RuntimeProfiler::Optimize(JSFunction* function,
   function->MarkForOptimization(ConcurrencyMode::kConcurrent);
 }
 
+void RuntimeProfiler::MarkBaselineCandidate(JSFunction* function) {
+  isolate_->counters()->runtime_profiler_baseline_candidates()->Increment();
+  if (FLAG_trace_baseline_candidates) {
+    PrintF("[baseline candidate ");
+    function->PrintName();
+    PrintF(", bytecode size: %d]\n",
+           function->shared()->bytecode_array()->length());
+  }
+}
+
 void RuntimeProfiler::AttemptOnStackReplacement(JavaScriptFrame* frame,
                                                 int loop_nesting_levels) {
   JSFunction* function = frame->function();
@@ -253,6 +263,14 @@ void RuntimeProfiler::MarkCandidatesForOptimization() {
     // TODO(leszeks): Move this increment to before the maybe optimize checks,
     // and update the tests to assume the increment has already happened.
     int ticks = function->feedback_vector()->profiler_ticks();
+    // The first tick makes a function warm. Unless it is already hot enough
+    // to be optimized, it is a candidate for baseline compilation.
+    if (ticks == 0 && !function->IsMarkedForOptimization() &&
+        !function->IsMarkedForConcurrentOptimization() &&
+        !function->IsInOptimizationQueue() &&
+        !function->HasOptimizedCode()) {
+      MarkBaselineCandidate(function);
+    }
     if (ticks < Smi::kMaxValue) {
       function->feedback_vector()->set_profiler_ticks(ticks + 1);
     }
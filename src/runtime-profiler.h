@@ -34,7 +34,10 @@ class RuntimeProfiler {
   OptimizationReason ShouldOptimize(JSFunction* function,
                                     JavaScriptFrame* frame);
   void Optimize(JSFunction* function, OptimizationReason reason);
-  void Baseline(JSFunction* function, OptimizationReason reason);
+  // Records a function that is warm, but not yet marked for optimization.
+  // Such functions would be compiled by a baseline tier, which does not exist
+  // yet.
+  void MarkBaselineCandidate(JSFunction* function);
 
   Isolate* isolate_;
   bool any_ic_changed_;
@@ -114,6 +114,8 @@ void CodeSerializer::SerializeObject(HeapObject* obj, HowToCode how_to_code,
     // Mark SFI to indicate whether the code is cached.
     bool was_deserialized = sfi->deserialized();
     sfi->set_deserialized(sfi->is_compiled());
+    // Uncompiled SFIs keep their PreParsedScopeData, so that compiling them
+    // after a cache hit does not have to preparse their inner functions.
     SerializeGeneric(obj, how_to_code, where_to_point);
     sfi->set_deserialized(was_deserialized);
     return;
@@ -216,22 +218,177 @@ WasmCompiledModuleSerializer::WasmCompiledModuleSerializer(
   reference_map()->AddAttachedReference(*module_bytes);
 }
 
+namespace {
+
+// With --wasm-lazy-deserialization, a serialized wasm module consists of
+//   [0] length of the serialized module (uint32), padded to pointer size
+//   ... the serialized module, in which every wasm function is a lazy compile
+//       stub, padded to pointer size
+//   ... the function section
+// The function section holds the code of each compiled wasm function as a
+// separately serialized object, which is deserialized on its first call:
+//   [0] number of functions, including imports (uint32)
+//   [1] number of function tables (uint32)
+//   ... per function: offset of its code within the section and length of its
+//       code (uint32 each), both 0 if the function was not compiled
+//   ... per function table: address of the function table and of the
+//       signature table at serialization time (uint64 each)
+//   ... the code of the functions
+const int kWasmModuleOffset = POINTER_SIZE_ALIGN(kUInt32Size);
+const int kNumFunctionsOffset = 0;
+const int kNumFunctionTablesOffset = kNumFunctionsOffset + kUInt32Size;
+const int kFunctionEntriesOffset = kNumFunctionTablesOffset + kUInt32Size;
+const int kFunctionEntrySize = 2 * kUInt32Size;
+const int kFunctionTableEntrySize = 2 * kInt64Size;
+
+size_t FunctionSectionHeaderSize(size_t num_functions,
+                                 size_t num_function_tables) {
+  return kFunctionEntriesOffset + num_functions * kFunctionEntrySize +
+         num_function_tables * kFunctionTableEntrySize;
+}
+
+bool IsValidFunctionSection(Vector<const byte> section, int num_functions,
+                            int num_function_tables) {
+  size_t size = section.length();
+  if (size < kFunctionEntriesOffset) return false;
+  const byte* start = section.start();
+  if (ReadUnalignedUInt32(start + kNumFunctionsOffset) !=
+          static_cast<uint32_t>(num_functions) ||
+      ReadUnalignedUInt32(start + kNumFunctionTablesOffset) !=
+          static_cast<uint32_t>(num_function_tables)) {
+    return false;
+  }
+  size_t header_size =
+      FunctionSectionHeaderSize(num_functions, num_function_tables);
+  if (size < header_size) return false;
+  for (int i = 0; i < num_functions; ++i) {
+    const byte* entry =
+        start + kFunctionEntriesOffset + i * kFunctionEntrySize;
+    size_t offset = ReadUnalignedUInt32(entry);
+    size_t length = ReadUnalignedUInt32(entry + kUInt32Size);
+    if (length == 0) continue;
+    if (offset < header_size || offset > size || length > size - offset) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
 std::unique_ptr<ScriptData> WasmCompiledModuleSerializer::SerializeWasmModule(
     Isolate* isolate, Handle<FixedArray> input) {
+  HistogramTimerScope timer(isolate->counters()->wasm_serialize_module_time());
   Handle<WasmCompiledModule> compiled_module =
       Handle<WasmCompiledModule>::cast(input);
-  WasmCompiledModuleSerializer wasm_cs(isolate, 0, isolate->native_context(),
-                                       handle(compiled_module->module_bytes()));
-  ScriptData* data = wasm_cs.Serialize(compiled_module);
-  return std::unique_ptr<ScriptData>(data);
+  Handle<SeqOneByteString> module_bytes(compiled_module->module_bytes(),
+                                        isolate);
+  // The function section of a lazily deserialized module is not serialized
+  // again. Functions which were not deserialized yet get compiled lazily.
+  ByteArray* lazy_function_data =
+      compiled_module->maybe_ptr_to_lazy_function_data();
+  compiled_module->reset_lazy_function_data();
+  ScriptData* module_data;
+  {
+    WasmCompiledModuleSerializer wasm_cs(isolate, 0, isolate->native_context(),
+                                         module_bytes);
+    module_data = wasm_cs.Serialize(compiled_module);
+  }
+  if (lazy_function_data != nullptr) {
+    compiled_module->set_ptr_to_lazy_function_data(lazy_function_data);
+  }
+  if (!FLAG_wasm_lazy_deserialization) {
+    return std::unique_ptr<ScriptData>(module_data);
+  }
+  std::unique_ptr<ScriptData> module_data_owner(module_data);
+
+  Handle<FixedArray> code_table = compiled_module->code_table();
+  int num_functions = code_table->length();
+  int num_function_tables =
+      static_cast<int>(compiled_module->module()->function_tables.size());
+  std::vector<std::unique_ptr<ScriptData>> function_data(num_functions);
+  size_t section_size =
+      FunctionSectionHeaderSize(num_functions, num_function_tables);
+  for (int i = compiled_module->num_imported_functions(); i < num_functions;
+       ++i) {
+    HandleScope scope(isolate);
+    Handle<Code> code(Code::cast(code_table->get(i)), isolate);
+    if (code->kind() != Code::WASM_FUNCTION) continue;
+    WasmCompiledModuleSerializer function_cs(
+        isolate, 0, isolate->native_context(), module_bytes);
+    function_cs.serialized_function_ = *code;
+    function_data[i].reset(function_cs.Serialize(code));
+    section_size += function_data[i]->length();
+  }
+
+  size_t section_offset =
+      kWasmModuleOffset + POINTER_SIZE_ALIGN(module_data->length());
+  size_t size = section_offset + section_size;
+  CHECK_GE(kMaxInt, size);
+  byte* data = NewArray<byte>(size);
+  memset(data, 0, size);
+  WriteUnalignedUInt32(data, module_data->length());
+  CopyBytes(data + kWasmModuleOffset, module_data->data(),
+            module_data->length());
+
+  byte* section = data + section_offset;
+  WriteUnalignedUInt32(section + kNumFunctionsOffset, num_functions);
+  WriteUnalignedUInt32(section + kNumFunctionTablesOffset, num_function_tables);
+  size_t offset = FunctionSectionHeaderSize(num_functions, num_function_tables);
+  for (int i = 0; i < num_functions; ++i) {
+    if (!function_data[i]) continue;
+    byte* entry = section + kFunctionEntriesOffset + i * kFunctionEntrySize;
+    uint32_t length = static_cast<uint32_t>(function_data[i]->length());
+    WriteUnalignedUInt32(entry, static_cast<uint32_t>(offset));
+    WriteUnalignedUInt32(entry + kUInt32Size, length);
+    CopyBytes(section + offset, function_data[i]->data(), length);
+    offset += length;
+  }
+  DCHECK_EQ(section_size, offset);
+  byte* tables = section + kFunctionEntriesOffset +
+                 num_functions * kFunctionEntrySize;
+  for (int i = 0; i < num_function_tables; ++i) {
+    Address function_table = WasmCompiledModule::GetTableValue(
+        compiled_module->ptr_to_function_tables(), i);
+    Address signature_table = WasmCompiledModule::GetTableValue(
+        compiled_module->ptr_to_signature_tables(), i);
+    byte* entry = tables + i * kFunctionTableEntrySize;
+    WriteUnalignedValue<uint64_t>(
+        entry, reinterpret_cast<uintptr_t>(function_table));
+    WriteUnalignedValue<uint64_t>(
+        entry + kInt64Size, reinterpret_cast<uintptr_t>(signature_table));
+  }
+
+  ScriptData* result = new ScriptData(data, static_cast<int>(size));
+  result->AcquireDataOwnership();
+  return std::unique_ptr<ScriptData>(result);
 }
 
 MaybeHandle<FixedArray> WasmCompiledModuleSerializer::DeserializeWasmModule(
     Isolate* isolate, ScriptData* data, Vector<const byte> wire_bytes) {
+  HistogramTimerScope timer(
+      isolate->counters()->wasm_deserialize_module_time());
   MaybeHandle<FixedArray> nothing;
   if (!wasm::IsWasmCodegenAllowed(isolate, isolate->native_context())) {
     return nothing;
   }
+
+  std::unique_ptr<ScriptData> module_data;
+  Vector<const byte> function_section;
+  if (FLAG_wasm_lazy_deserialization) {
+    if (data->length() < kWasmModuleOffset) return nothing;
+    uint32_t module_length = ReadUnalignedUInt32(data->data());
+    size_t section_offset =
+        kWasmModuleOffset + POINTER_SIZE_ALIGN(size_t{module_length});
+    if (section_offset > static_cast<size_t>(data->length())) return nothing;
+    module_data.reset(new ScriptData(data->data() + kWasmModuleOffset,
+                                     static_cast<int>(module_length)));
+    function_section =
+        Vector<const byte>(data->data() + section_offset,
+                           data->length() - static_cast<int>(section_offset));
+    data = module_data.get();
+  }
+
   SerializedCodeData::SanityCheckResult sanity_check_result =
       SerializedCodeData::CHECK_SUCCESS;
 
@@ -251,14 +408,90 @@ MaybeHandle<FixedArray> WasmCompiledModuleSerializer::DeserializeWasmModule(
 
   WasmCompiledModule::ReinitializeAfterDeserialization(isolate, result);
   DCHECK(WasmCompiledModule::IsWasmCompiledModule(*result));
+
+  if (FLAG_wasm_lazy_deserialization) {
+    int num_function_tables =
+        static_cast<int>(result->module()->function_tables.size());
+    if (!IsValidFunctionSection(function_section,
+                                result->code_table()->length(),
+                                num_function_tables)) {
+      return nothing;
+    }
+    Handle<ByteArray> lazy_function_data =
+        isolate->factory()->NewByteArray(function_section.length(), TENURED);
+    lazy_function_data->copy_in(0, function_section.start(),
+                                function_section.length());
+    result->set_lazy_function_data(lazy_function_data);
+    WasmSharedModuleData::PrepareForLazyCompilation(result->shared());
+  }
   return result;
 }
 
+MaybeHandle<Code> WasmCompiledModuleSerializer::DeserializeWasmFunction(
+    Isolate* isolate, Handle<WasmCompiledModule> compiled_module,
+    int func_index, std::vector<Address>* function_tables,
+    std::vector<Address>* signature_tables) {
+  MaybeHandle<Code> nothing;
+  if (!compiled_module->has_lazy_function_data()) return nothing;
+  std::unique_ptr<byte[]> function_data;
+  uint32_t length;
+  {
+    DisallowHeapAllocation no_gc;
+    const byte* section =
+        compiled_module->ptr_to_lazy_function_data()->GetDataStartAddress();
+    uint32_t num_functions =
+        ReadUnalignedUInt32(section + kNumFunctionsOffset);
+    uint32_t num_function_tables =
+        ReadUnalignedUInt32(section + kNumFunctionTablesOffset);
+    DCHECK_GT(static_cast<int>(num_functions), func_index);
+    const byte* entry =
+        section + kFunctionEntriesOffset + func_index * kFunctionEntrySize;
+    uint32_t offset = ReadUnalignedUInt32(entry);
+    length = ReadUnalignedUInt32(entry + kUInt32Size);
+    if (length == 0) return nothing;
+
+    const byte* tables = section + kFunctionEntriesOffset +
+                         num_functions * kFunctionEntrySize;
+    for (uint32_t i = 0; i < num_function_tables; ++i) {
+      const byte* table_entry = tables + i * kFunctionTableEntrySize;
+      function_tables->push_back(reinterpret_cast<Address>(
+          static_cast<uintptr_t>(ReadUnalignedValue<uint64_t>(table_entry))));
+      signature_tables->push_back(reinterpret_cast<Address>(
+          static_cast<uintptr_t>(
+              ReadUnalignedValue<uint64_t>(table_entry + kInt64Size))));
+    }
+
+    // Deserialization allocates, so copy the code out of the heap first.
+    function_data.reset(NewArray<byte>(length));
+    CopyBytes(function_data.get(), section + offset, length);
+  }
+
+  ScriptData script_data(function_data.get(), static_cast<int>(length));
+  SerializedCodeData::SanityCheckResult sanity_check_result =
+      SerializedCodeData::CHECK_SUCCESS;
+  const SerializedCodeData scd = SerializedCodeData::FromCachedData(
+      isolate, &script_data, 0, &sanity_check_result);
+  if (sanity_check_result != SerializedCodeData::CHECK_SUCCESS) {
+    return nothing;
+  }
+  return ObjectDeserializer::DeserializeWasmCode(
+      isolate, &scd, handle(compiled_module->module_bytes(), isolate));
+}
+
 void WasmCompiledModuleSerializer::SerializeCodeObject(
     Code* code_object, HowToCode how_to_code, WhereToPoint where_to_point) {
   Code::Kind kind = code_object->kind();
   switch (kind) {
     case Code::WASM_FUNCTION:
+      if (FLAG_wasm_lazy_deserialization &&
+          code_object != serialized_function_) {
+        // Functions are serialized separately and deserialized on their first
+        // call (see {SerializeWasmModule}).
+        SerializeBuiltinReference(*BUILTIN_CODE(isolate(), WasmCompileLazy),
+                                  how_to_code, where_to_point, 0);
+        break;
+      }
+    // Fall through.
     case Code::JS_TO_WASM_FUNCTION: {
       // Because the trap handler index is not meaningful across copies and
       // serializations, we need to serialize it as kInvalidIndex. We do this by
@@ -11,6 +11,8 @@
 namespace v8 {
 namespace internal {
 
+class WasmCompiledModule;
+
 class CodeSerializer : public Serializer<> {
  public:
   static ScriptData* Serialize(Isolate* isolate,
@@ -60,6 +62,16 @@ class WasmCompiledModuleSerializer : public CodeSerializer {
   static MaybeHandle<FixedArray> DeserializeWasmModule(
       Isolate* isolate, ScriptData* data, Vector<const byte> wire_bytes);
 
+  // Deserializes function {func_index} of a module deserialized with
+  // --wasm-lazy-deserialization. Fails if the function was not serialized.
+  // The code still refers to the function and signature tables the module
+  // had when it was serialized; their addresses are returned in
+  // {function_tables} and {signature_tables}.
+  static MaybeHandle<Code> DeserializeWasmFunction(
+      Isolate* isolate, Handle<WasmCompiledModule> compiled_module,
+      int func_index, std::vector<Address>* function_tables,
+      std::vector<Address>* signature_tables);
+
  protected:
   void SerializeCodeObject(Code* code_object, HowToCode how_to_code,
                            WhereToPoint where_to_point) override;
@@ -69,6 +81,11 @@ class WasmCompiledModuleSerializer : public CodeSerializer {
   WasmCompiledModuleSerializer(Isolate* isolate, uint32_t source_hash,
                                Handle<Context> native_context,
                                Handle<SeqOneByteString> module_bytes);
+
+  // With --wasm-lazy-deserialization, every wasm function other than this one
+  // is serialized as a lazy compile stub.
+  Code* serialized_function_ = nullptr;
+
   DISALLOW_COPY_AND_ASSIGN(WasmCompiledModuleSerializer);
 };
 
@@ -65,6 +65,27 @@ ObjectDeserializer::DeserializeWasmCompiledModule(
   return handle(static_cast<WasmCompiledModule*>(*result), isolate);
 }
 
+MaybeHandle<Code> ObjectDeserializer::DeserializeWasmCode(
+    Isolate* isolate, const SerializedCodeData* data,
+    Handle<SeqOneByteString> module_bytes) {
+  ObjectDeserializer d(data);
+
+  d.AddAttachedObject(isolate->native_context());
+  d.AddAttachedObject(module_bytes);
+
+  Vector<const uint32_t> code_stub_keys = data->CodeStubKeys();
+  for (int i = 0; i < code_stub_keys.length(); i++) {
+    d.AddAttachedObject(
+        CodeStub::GetCode(isolate, code_stub_keys[i]).ToHandleChecked());
+  }
+
+  Handle<HeapObject> result;
+  if (!d.Deserialize(isolate).ToHandle(&result)) return MaybeHandle<Code>();
+
+  if (!result->IsCode()) return MaybeHandle<Code>();
+  return Handle<Code>::cast(result);
+}
+
 MaybeHandle<HeapObject> ObjectDeserializer::Deserialize(Isolate* isolate) {
   Initialize(isolate);
   if (!allocator()->ReserveSpace()) return MaybeHandle<HeapObject>();
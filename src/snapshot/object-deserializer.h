@@ -24,6 +24,10 @@ class ObjectDeserializer final : public Deserializer<> {
       Isolate* isolate, const SerializedCodeData* data,
       Vector<const byte> wire_bytes);
 
+  static MaybeHandle<Code> DeserializeWasmCode(
+      Isolate* isolate, const SerializedCodeData* data,
+      Handle<SeqOneByteString> module_bytes);
+
  private:
   explicit ObjectDeserializer(const SerializedCodeData* data)
       : Deserializer(data, true) {}
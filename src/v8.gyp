@@ -712,6 +712,8 @@
         'compiler/common-operator-reducer.h',
         'compiler/common-operator.cc',
         'compiler/common-operator.h',
+        'compiler/compilation-budget.cc',
+        'compiler/compilation-budget.h',
         'compiler/control-equivalence.cc',
         'compiler/control-equivalence.h',
         'compiler/control-flow-optimizer.cc',
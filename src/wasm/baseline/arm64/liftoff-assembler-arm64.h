@@ -52,6 +52,27 @@ DEFAULT_I32_BINOP(xor, xor)
 
 #undef DEFAULT_I32_BINOP
 
+#define I32_COMPARE(name)                                            \
+  void LiftoffAssembler::emit_i32_##name(Register dst, Register lhs, \
+                                         Register rhs) {}
+
+// clang-format off
+I32_COMPARE(eq)
+I32_COMPARE(ne)
+I32_COMPARE(lt_s)
+I32_COMPARE(lt_u)
+I32_COMPARE(gt_s)
+I32_COMPARE(gt_u)
+I32_COMPARE(le_s)
+I32_COMPARE(le_u)
+I32_COMPARE(ge_s)
+I32_COMPARE(ge_u)
+// clang-format on
+
+#undef I32_COMPARE
+
+void LiftoffAssembler::emit_i32_eqz(Register dst, Register src) {}
+
 void LiftoffAssembler::JumpIfZero(Register reg, Label* label) {}
 
 }  // namespace wasm
@@ -118,6 +118,48 @@ DEFAULT_I32_BINOP(xor, xor_)
 
 #undef DEFAULT_I32_BINOP
 
+namespace liftoff {
+
+// Not all cache registers have a byte register, so we cannot use {setcc}.
+// {mov} does not change the flags set by the preceding compare.
+inline void SetIfCondition(LiftoffAssembler* assm, Condition cond,
+                           Register dst) {
+  Label done;
+  assm->mov(dst, Immediate(1));
+  assm->j(cond, &done, Label::kNear);
+  assm->mov(dst, Immediate(0));
+  assm->bind(&done);
+}
+
+}  // namespace liftoff
+
+#define I32_COMPARE(name, cond)                                      \
+  void LiftoffAssembler::emit_i32_##name(Register dst, Register lhs, \
+                                         Register rhs) {             \
+    cmp(lhs, rhs);                                                   \
+    liftoff::SetIfCondition(this, cond, dst);                        \
+  }
+
+// clang-format off
+I32_COMPARE(eq, equal)
+I32_COMPARE(ne, not_equal)
+I32_COMPARE(lt_s, less)
+I32_COMPARE(lt_u, below)
+I32_COMPARE(gt_s, greater)
+I32_COMPARE(gt_u, above)
+I32_COMPARE(le_s, less_equal)
+I32_COMPARE(le_u, below_equal)
+I32_COMPARE(ge_s, greater_equal)
+I32_COMPARE(ge_u, above_equal)
+// clang-format on
+
+#undef I32_COMPARE
+
+void LiftoffAssembler::emit_i32_eqz(Register dst, Register src) {
+  test(src, src);
+  liftoff::SetIfCondition(this, zero, dst);
+}
+
 void LiftoffAssembler::JumpIfZero(Register reg, Label* label) {
   test(reg, reg);
   j(zero, label);
@@ -244,6 +244,19 @@ class LiftoffAssembler : public TurboAssembler {
   inline void emit_i32_or(Register dst, Register lhs, Register rhs);
   inline void emit_i32_xor(Register dst, Register lhs, Register rhs);
 
+  // Comparisons set {dst} to 1 if the condition holds, and to 0 otherwise.
+  inline void emit_i32_eq(Register dst, Register lhs, Register rhs);
+  inline void emit_i32_ne(Register dst, Register lhs, Register rhs);
+  inline void emit_i32_lt_s(Register dst, Register lhs, Register rhs);
+  inline void emit_i32_lt_u(Register dst, Register lhs, Register rhs);
+  inline void emit_i32_gt_s(Register dst, Register lhs, Register rhs);
+  inline void emit_i32_gt_u(Register dst, Register lhs, Register rhs);
+  inline void emit_i32_le_s(Register dst, Register lhs, Register rhs);
+  inline void emit_i32_le_u(Register dst, Register lhs, Register rhs);
+  inline void emit_i32_ge_s(Register dst, Register lhs, Register rhs);
+  inline void emit_i32_ge_u(Register dst, Register lhs, Register rhs);
+  inline void emit_i32_eqz(Register dst, Register src);
+
   inline void JumpIfZero(Register, Label*);
 
   // Platform-specific constant.
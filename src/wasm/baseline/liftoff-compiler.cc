@@ -46,6 +46,10 @@ class LiftoffCompiler {
     // TODO(clemensh): Labels cannot be moved on arm64, but everywhere else.
     // Find a better solution.
     std::unique_ptr<Label> label = base::make_unique<Label>();
+    // Only used for if blocks: the start of the else branch, and the cache
+    // state to execute it with.
+    std::unique_ptr<Label> else_label;
+    LiftoffAssembler::CacheState else_state;
   };
 
   using Decoder = WasmFullDecoder<validate, LiftoffCompiler>;
@@ -73,8 +77,11 @@ class LiftoffCompiler {
     // Bind all labels now, otherwise their destructor will fire a DCHECK error
     // if they where referenced before.
     for (uint32_t i = 0, e = decoder->control_depth(); i < e; ++i) {
-      Label* label = decoder->control_at(i)->label.get();
-      if (!label->is_bound()) __ bind(label);
+      Control* c = decoder->control_at(i);
+      if (!c->label->is_bound()) __ bind(c->label.get());
+      if (c->else_label && !c->else_label->is_bound()) {
+        __ bind(c->else_label.get());
+      }
     }
   }
 
@@ -187,12 +194,28 @@ class LiftoffCompiler {
 
   void Try(Decoder* decoder, Control* block) { unsupported(decoder, "try"); }
   void If(Decoder* decoder, const Value& cond, Control* if_block) {
-    unsupported(decoder, "if");
+    DCHECK_EQ(if_block, decoder->control_at(0));
+    DCHECK(if_block->is_if());
+    if (if_block->start_merge.arity > 0 || if_block->end_merge.arity > 1) {
+      return unsupported(decoder, "multi-value if");
+    }
+    if_block->else_label = base::make_unique<Label>();
+    Register value = __ PopToRegister(kWasmI32);
+    __ JumpIfZero(value, if_block->else_label.get());
+    if_block->label_state.stack_base = __ cache_state()->stack_height();
+    // Remember the state (after popping the condition) for the else branch.
+    if_block->else_state.Split(*__ cache_state());
   }
 
   void FallThruTo(Decoder* decoder, Control* c) {
     if (c->end_merge.reached) {
       __ MergeFullStackWith(c->label_state);
+    } else if (c->is_if()) {
+      // The other arm of the if merges into the same state later, so we cannot
+      // just take over the current state (it might hold constants).
+      c->label_state.InitMerge(*__ cache_state(), __ num_locals(),
+                               c->end_merge.arity);
+      __ MergeFullStackWith(c->label_state);
     } else {
       c->label_state.Split(*__ cache_state());
     }
@@ -211,7 +234,23 @@ class LiftoffCompiler {
 
   void UnOp(Decoder* decoder, WasmOpcode opcode, FunctionSig*,
             const Value& value, Value* result) {
-    unsupported(decoder, "unary operation");
+    void (LiftoffAssembler::*emit_fn)(Register, Register);
+    switch (opcode) {
+      case WasmOpcode::kExprI32Eqz:
+        emit_fn = &LiftoffAssembler::emit_i32_eqz;
+        break;
+      default:
+        return unsupported(decoder, WasmOpcodes::OpcodeName(opcode));
+    }
+
+    LiftoffAssembler::PinnedRegisterScope pinned_regs;
+    Register src_reg = pinned_regs.pin(__ PopToRegister(kWasmI32));
+    // Reuse the source register if this was its last use.
+    Register target_reg = __ cache_state()->is_free(src_reg)
+                              ? src_reg
+                              : __ GetUnusedRegister(kWasmI32, pinned_regs);
+    (asm_->*emit_fn)(target_reg, src_reg);
+    __ PushRegister(target_reg);
   }
 
   void BinOp(Decoder* decoder, WasmOpcode opcode, FunctionSig*,
@@ -228,6 +267,16 @@ class LiftoffCompiler {
       CASE_EMIT_FN(I32And, i32_and)
       CASE_EMIT_FN(I32Ior, i32_or)
       CASE_EMIT_FN(I32Xor, i32_xor)
+      CASE_EMIT_FN(I32Eq, i32_eq)
+      CASE_EMIT_FN(I32Ne, i32_ne)
+      CASE_EMIT_FN(I32LtS, i32_lt_s)
+      CASE_EMIT_FN(I32LtU, i32_lt_u)
+      CASE_EMIT_FN(I32GtS, i32_gt_s)
+      CASE_EMIT_FN(I32GtU, i32_gt_u)
+      CASE_EMIT_FN(I32LeS, i32_le_s)
+      CASE_EMIT_FN(I32LeU, i32_le_u)
+      CASE_EMIT_FN(I32GeS, i32_ge_s)
+      CASE_EMIT_FN(I32GeU, i32_ge_u)
       default:
         return unsupported(decoder, WasmOpcodes::OpcodeName(opcode));
     }
@@ -380,7 +429,24 @@ class LiftoffCompiler {
 
   void Select(Decoder* decoder, const Value& cond, const Value& fval,
               const Value& tval, Value* result) {
-    unsupported(decoder, "select");
+    if (tval.type != kWasmI32) return unsupported(decoder, "non-i32 select");
+    LiftoffAssembler::PinnedRegisterScope pinned_regs;
+    Register cond_reg = pinned_regs.pin(__ PopToRegister(kWasmI32));
+    Register fval_reg =
+        pinned_regs.pin(__ PopToRegister(kWasmI32, pinned_regs));
+    Register tval_reg =
+        pinned_regs.pin(__ PopToRegister(kWasmI32, pinned_regs));
+    // Write the result into the false value register if this was its last
+    // use. Otherwise copy the false value into a fresh register first.
+    Register target_reg = __ cache_state()->is_free(fval_reg)
+                              ? fval_reg
+                              : __ GetUnusedRegister(kWasmI32, pinned_regs);
+    if (target_reg != fval_reg) __ Move(target_reg, fval_reg);
+    Label done;
+    __ JumpIfZero(cond_reg, &done);
+    if (target_reg != tval_reg) __ Move(target_reg, tval_reg);
+    __ bind(&done);
+    __ PushRegister(target_reg);
   }
 
   void Br(Decoder* decoder, Control* target) {
@@ -406,7 +472,9 @@ class LiftoffCompiler {
     unsupported(decoder, "br_table");
   }
   void Else(Decoder* decoder, Control* if_block) {
-    unsupported(decoder, "else");
+    if (if_block->reachable()) __ jmp(if_block->label.get());
+    __ bind(if_block->else_label.get());
+    __ cache_state()->Steal(if_block->else_state);
   }
   void LoadMem(Decoder* decoder, ValueType type, MachineType mem_type,
                const MemoryAccessOperand<validate>& operand, const Value& index,
@@ -467,6 +535,14 @@ class LiftoffCompiler {
                 const MemoryAccessOperand<validate>& operand, Value* result) {
     unsupported(decoder, "atomicop");
   }
+  void MemoryCopy(Decoder* decoder, const Value& dst, const Value& src,
+                  const Value& size) {
+    unsupported(decoder, "memory.copy");
+  }
+  void MemoryFill(Decoder* decoder, const Value& dst, const Value& value,
+                  const Value& size) {
+    unsupported(decoder, "memory.fill");
+  }
 
  private:
   LiftoffAssembler* asm_;
@@ -124,6 +124,35 @@ DEFAULT_I32_BINOP(xor, xor)
 
 #undef DEFAULT_I32_BINOP
 
+#define I32_COMPARE(name, cond)                                      \
+  void LiftoffAssembler::emit_i32_##name(Register dst, Register lhs, \
+                                         Register rhs) {             \
+    cmpl(lhs, rhs);                                                  \
+    setcc(cond, dst);                                                \
+    movzxbl(dst, dst);                                               \
+  }
+
+// clang-format off
+I32_COMPARE(eq, equal)
+I32_COMPARE(ne, not_equal)
+I32_COMPARE(lt_s, less)
+I32_COMPARE(lt_u, below)
+I32_COMPARE(gt_s, greater)
+I32_COMPARE(gt_u, above)
+I32_COMPARE(le_s, less_equal)
+I32_COMPARE(le_u, below_equal)
+I32_COMPARE(ge_s, greater_equal)
+I32_COMPARE(ge_u, above_equal)
+// clang-format on
+
+#undef I32_COMPARE
+
+void LiftoffAssembler::emit_i32_eqz(Register dst, Register src) {
+  testl(src, src);
+  setcc(zero, dst);
+  movzxbl(dst, dst);
+}
+
 void LiftoffAssembler::JumpIfZero(Register reg, Label* label) {
   testl(reg, reg);
   j(zero, label);
@@ -607,7 +607,9 @@ struct ControlWithNamedConstructors : public ControlBase<Value> {
   F(CatchException, const ExceptionIndexOperand<validate>& operand,            \
     Control* block, Vector<Value> caught_values)                               \
   F(AtomicOp, WasmOpcode opcode, Vector<Value> args,                           \
-    const MemoryAccessOperand<validate>& operand, Value* result)
+    const MemoryAccessOperand<validate>& operand, Value* result)               \
+  F(MemoryCopy, const Value& dst, const Value& src, const Value& size)         \
+  F(MemoryFill, const Value& dst, const Value& value, const Value& size)
 
 // Generic Wasm bytecode decoder with utilities for decoding operands,
 // lengths, etc.
@@ -1019,6 +1021,22 @@ class WasmDecoder : public Decoder {
             return 2;
         }
       }
+      case kNumericPrefix: {
+        byte numeric_index =
+            decoder->read_u8<validate>(pc + 1, "numeric_index");
+        WasmOpcode opcode =
+            static_cast<WasmOpcode>(kNumericPrefix << 8 | numeric_index);
+        switch (opcode) {
+          case kExprMemoryCopy:
+          case kExprMemoryFill: {
+            MemoryIndexOperand<validate> operand(decoder, pc + 1);
+            return 2 + operand.length;
+          }
+          default:
+            decoder->error(pc, "invalid numeric opcode");
+            return 2;
+        }
+      }
       default:
         return 1;
     }
@@ -1047,6 +1065,9 @@ class WasmDecoder : public Decoder {
       case kExprTeeLocal:
       case kExprGrowMemory:
         return {1, 1};
+      case kExprMemoryCopy:
+      case kExprMemoryFill:
+        return {3, 0};
       case kExprSetLocal:
       case kExprSetGlobal:
       case kExprDrop:
@@ -1764,6 +1785,18 @@ class WasmFullDecoder : public WasmDecoder<validate> {
             len += DecodeAtomicOpcode(opcode);
             break;
           }
+          case kNumericPrefix: {
+            CHECK_PROTOTYPE_OPCODE(bulk_memory);
+            if (!CheckHasMemory()) break;
+            len++;
+            byte numeric_index = this->template read_u8<validate>(
+                this->pc_ + 1, "numeric index");
+            opcode = static_cast<WasmOpcode>(opcode << 8 | numeric_index);
+            TRACE("  @%-4d #%-20s|", startrel(this->pc_),
+                  WasmOpcodes::OpcodeName(opcode));
+            len += DecodeNumericOpcode(opcode);
+            break;
+          }
           default: {
             // Deal with special asmjs opcodes.
             if (this->module_ != nullptr && this->module_->is_asm_js()) {
@@ -2134,6 +2167,30 @@ class WasmFullDecoder : public WasmDecoder<validate> {
     return len;
   }
 
+  unsigned DecodeNumericOpcode(WasmOpcode opcode) {
+    switch (opcode) {
+      case kExprMemoryCopy: {
+        MemoryIndexOperand<validate> operand(this, this->pc_ + 1);
+        auto size = Pop(2, kWasmI32);
+        auto src = Pop(1, kWasmI32);
+        auto dst = Pop(0, kWasmI32);
+        CALL_INTERFACE_IF_REACHABLE(MemoryCopy, dst, src, size);
+        return operand.length;
+      }
+      case kExprMemoryFill: {
+        MemoryIndexOperand<validate> operand(this, this->pc_ + 1);
+        auto size = Pop(2, kWasmI32);
+        auto value = Pop(1, kWasmI32);
+        auto dst = Pop(0, kWasmI32);
+        CALL_INTERFACE_IF_REACHABLE(MemoryFill, dst, value, size);
+        return operand.length;
+      }
+      default:
+        this->error("invalid numeric opcode");
+        return 0;
+    }
+  }
+
   void DoReturn(Control* c, bool implicit) {
     int return_count = static_cast<int>(this->sig_->return_count());
     args_.resize(return_count);
@@ -500,6 +500,16 @@ class WasmGraphBuildingInterface {
     if (result) result->node = node;
   }
 
+  void MemoryCopy(Decoder* decoder, const Value& dst, const Value& src,
+                  const Value& size) {
+    BUILD(MemoryCopy, dst.node, src.node, size.node, decoder->position());
+  }
+
+  void MemoryFill(Decoder* decoder, const Value& dst, const Value& value,
+                  const Value& size) {
+    BUILD(MemoryFill, dst.node, value.node, size.node, decoder->position());
+  }
+
  private:
   SsaEnv* ssa_env_;
   TFBuilder* builder_;
@@ -15,6 +15,7 @@
 #include "src/compiler/wasm-compiler.h"
 #include "src/counters.h"
 #include "src/property-descriptor.h"
+#include "src/snapshot/code-serializer.h"
 #include "src/wasm/compilation-manager.h"
 #include "src/wasm/module-decoder.h"
 #include "src/wasm/wasm-code-specialization.h"
@@ -107,6 +108,8 @@ class ModuleCompiler {
 
     void Clear() { units_.clear(); }
 
+    size_t size() const { return units_.size(); }
+
    private:
     ModuleCompiler* compiler_;
     std::vector<std::unique_ptr<compiler::WasmCompilationUnit>> units_;
@@ -218,6 +221,26 @@ class ModuleCompiler {
   Handle<Code> centry_stub_;
 };
 
+namespace {
+
+// Patches a copy of a JS-to-wasm wrapper to call {wasm_code}.
+void PatchJSToWasmWrapper(Isolate* isolate, Handle<Code> code,
+                          Handle<Code> wasm_code) {
+  for (RelocIterator it(*code, RelocInfo::kCodeTargetMask);; it.next()) {
+    DCHECK(!it.done());
+    Code* target = Code::GetCodeFromTargetAddress(it.rinfo()->target_address());
+    if (target->kind() == Code::WASM_FUNCTION ||
+        target->kind() == Code::WASM_TO_JS_FUNCTION ||
+        target->builtin_index() == Builtins::kIllegal ||
+        target->builtin_index() == Builtins::kWasmCompileLazy) {
+      it.rinfo()->set_target_address(isolate, wasm_code->instruction_start());
+      break;
+    }
+  }
+}
+
+}  // namespace
+
 class JSToWasmWrapperCache {
  public:
   void SetContextAddress(Address context_address) {
@@ -230,24 +253,16 @@ class JSToWasmWrapperCache {
                                              wasm::WasmModule* module,
                                              Handle<Code> wasm_code,
                                              uint32_t index) {
+    // Wrappers without a bound WasmContext are shared across modules.
+    if (context_address_ == nullptr && FLAG_wasm_shared_wrapper_cache) {
+      return isolate->wasm_wrapper_templates()->GetWrapper(isolate, module,
+                                                           wasm_code, index);
+    }
     const wasm::WasmFunction* func = &module->functions[index];
     int cached_idx = sig_map_.Find(func->sig);
     if (cached_idx >= 0) {
       Handle<Code> code = isolate->factory()->CopyCode(code_cache_[cached_idx]);
-      // Now patch the call to wasm code.
-      for (RelocIterator it(*code, RelocInfo::kCodeTargetMask);; it.next()) {
-        DCHECK(!it.done());
-        Code* target =
-            Code::GetCodeFromTargetAddress(it.rinfo()->target_address());
-        if (target->kind() == Code::WASM_FUNCTION ||
-            target->kind() == Code::WASM_TO_JS_FUNCTION ||
-            target->builtin_index() == Builtins::kIllegal ||
-            target->builtin_index() == Builtins::kWasmCompileLazy) {
-          it.rinfo()->set_target_address(isolate,
-                                         wasm_code->instruction_start());
-          break;
-        }
-      }
+      PatchJSToWasmWrapper(isolate, code, wasm_code);
       return code;
     }
 
@@ -618,6 +633,39 @@ void AsyncCompile(Isolate* isolate, Handle<JSPromise> promise,
       promise);
 }
 
+JSToWasmWrapperTemplates::JSToWasmWrapperTemplates(
+    AccountingAllocator* allocator)
+    : zone_(allocator, ZONE_NAME) {}
+
+Handle<Code> JSToWasmWrapperTemplates::GetWrapper(Isolate* isolate,
+                                                  WasmModule* module,
+                                                  Handle<Code> wasm_code,
+                                                  uint32_t index) {
+  FunctionSig* sig = module->functions[index].sig;
+  int cached_idx = sig_map_.Find(sig);
+  if (cached_idx < 0) {
+    // Compile against the Illegal builtin, so that the template does not keep
+    // the wasm code of this module alive.
+    Handle<Code> code = compiler::CompileJSToWasmWrapper(
+        isolate, module, BUILTIN_CODE(isolate, Illegal), index, nullptr);
+    size_t count = sig->return_count() + sig->parameter_count();
+    ValueType* reps = zone_.NewArray<ValueType>(count);
+    std::copy(sig->all().begin(), sig->all().end(), reps);
+    FunctionSig* sig_copy = new (&zone_)
+        FunctionSig(sig->return_count(), sig->parameter_count(), reps);
+    cached_idx = static_cast<int>(sig_map_.FindOrInsert(sig_copy));
+    DCHECK_EQ(templates_.size(), static_cast<size_t>(cached_idx));
+    templates_.push_back(
+        Handle<Code>::cast(isolate->global_handles()->Create(*code)));
+    isolate->counters()->wasm_js_to_wasm_wrappers_compiled()->Increment();
+  } else {
+    isolate->counters()->wasm_js_to_wasm_wrappers_reused()->Increment();
+  }
+  Handle<Code> code = isolate->factory()->CopyCode(templates_[cached_idx]);
+  PatchJSToWasmWrapper(isolate, code, wasm_code);
+  return code;
+}
+
 Handle<Code> CompileLazy(Isolate* isolate) {
   HistogramTimerScope lazy_time_scope(
       isolate->counters()->wasm_lazy_compilation_time());
@@ -731,6 +779,10 @@ void LazyCompilationOrchestrator::CompileFunction(
       Code::WASM_FUNCTION) {
     return;
   }
+  if (compiled_module->has_lazy_function_data() &&
+      DeserializeFunction(isolate, instance, func_index)) {
+    return;
+  }
 
   compiler::ModuleEnv module_env =
       CreateModuleEnvFromCompiledModule(isolate, compiled_module);
@@ -797,6 +849,58 @@ void LazyCompilationOrchestrator::CompileFunction(
                             : 0);
 }
 
+bool LazyCompilationOrchestrator::DeserializeFunction(
+    Isolate* isolate, Handle<WasmInstanceObject> instance, int func_index) {
+  Handle<WasmCompiledModule> compiled_module(instance->compiled_module(),
+                                             isolate);
+  std::vector<GlobalHandleAddress> function_tables;
+  std::vector<GlobalHandleAddress> signature_tables;
+  Handle<Code> code;
+  if (!WasmCompiledModuleSerializer::DeserializeWasmFunction(
+           isolate, compiled_module, func_index, &function_tables,
+           &signature_tables)
+           .ToHandle(&code)) {
+    return false;
+  }
+
+  Handle<FixedArray> deopt_data = isolate->factory()->NewFixedArray(2, TENURED);
+  Handle<WeakCell> weak_instance = isolate->factory()->NewWeakCell(instance);
+  deopt_data->set(0, *weak_instance);
+  deopt_data->set(1, Smi::FromInt(func_index));
+  code->set_deoptimization_data(*deopt_data);
+
+  DCHECK_EQ(Builtins::kWasmCompileLazy,
+            Code::cast(compiled_module->code_table()->get(func_index))
+                ->builtin_index());
+  compiled_module->code_table()->set(func_index, *code);
+
+  // Specialize the code for this instance. Besides the direct calls, this
+  // includes the function and signature tables, which the code still refers
+  // to as they were at serialization time.
+  Zone specialization_zone(isolate->allocator(), ZONE_NAME);
+  CodeSpecialization code_specialization(isolate, &specialization_zone);
+  DCHECK_EQ(compiled_module->module()->function_tables.size(),
+            function_tables.size());
+  for (int i = 0, e = static_cast<int>(function_tables.size()); i < e; ++i) {
+    code_specialization.RelocatePointer(
+        function_tables[i], WasmCompiledModule::GetTableValue(
+                                compiled_module->ptr_to_function_tables(), i));
+    code_specialization.RelocatePointer(
+        signature_tables[i],
+        WasmCompiledModule::GetTableValue(
+            compiled_module->ptr_to_signature_tables(), i));
+  }
+  code_specialization.RelocateDirectCalls(instance);
+  code_specialization.ApplyToWasmCode(*code, SKIP_ICACHE_FLUSH);
+  Assembler::FlushICache(isolate, code->instruction_start(),
+                         code->instruction_size());
+  if (trap_handler::UseTrapHandler()) {
+    UnpackAndRegisterProtectedInstructions(isolate, *code);
+  }
+  isolate->counters()->wasm_lazily_deserialized_functions()->Increment();
+  return true;
+}
+
 int AdvanceSourcePositionTableIterator(SourcePositionTableIterator& iterator,
                                        int offset) {
   DCHECK(!iterator.done());
@@ -1891,6 +1995,16 @@ MaybeHandle<WasmInstanceObject> InstanceBuilder::Build() {
     }
   }
 
+  // The functions of a lazily deserialized module start out as plain lazy
+  // compile stubs. Exported ones need deopt data to find their instance when
+  // called through a JS-to-wasm wrapper.
+  if (compiled_module_->has_lazy_function_data()) {
+    for (auto exp : module_->export_table) {
+      if (exp.kind != kExternalFunction) continue;
+      EnsureExportedLazyDeoptData(isolate_, instance, code_table, exp.index);
+    }
+  }
+
   //--------------------------------------------------------------------------
   // Set up the exports object for the new instance.
   //--------------------------------------------------------------------------
@@ -2698,11 +2812,13 @@ void InstanceBuilder::InitializeTables(
         table_instance.signature_table->set(i, Smi::FromInt(kInvalidSigIndex));
       }
     } else {
-      // Table is imported, patch table bounds check
+      // Table is imported, it might have grown beyond its initial size.
       DCHECK_LE(table_size, table_instance.function_table->length());
-      code_specialization->PatchTableSize(
-          table_size, table_instance.function_table->length());
     }
+    // Indirect calls load the table size from the WasmContext.
+    DCHECK_EQ(0, index);
+    instance->wasm_context()->get()->function_table_size =
+        static_cast<uint32_t>(table_instance.function_table->length());
     int int_index = static_cast<int>(index);
 
     Handle<FixedArray> global_func_table =
@@ -2767,7 +2883,7 @@ void InstanceBuilder::LoadTableSegments(Handle<FixedArray> code_table,
     // Count the number of table exports for each function (needed for lazy
     // compilation).
     std::unordered_map<uint32_t, uint32_t> num_table_exports;
-    if (compile_lazy(module_)) {
+    if (compile_lazy(module_) || compiled_module_->has_lazy_function_data()) {
       for (auto& table_init : module_->table_inits) {
         for (uint32_t func_index : table_init.entries) {
           Code* code =
@@ -2914,6 +3030,14 @@ class AsyncStreamingProcessor final : public StreamingProcessor {
   // Finishes the AsyncCOmpileJob with an error.
   void FinishAsyncCompileJobWithError(ResultBase result);
 
+  // Moves the buffered compilation units to the background tasks.
+  void CommitCompilationUnits();
+
+  // A single chunk of the stream can contain many function bodies. We hand
+  // units to the background tasks once this many are buffered, so that
+  // compilation overlaps with the decoding of the rest of the chunk.
+  static constexpr size_t kMaxBufferedUnits = 16;
+
   ModuleDecoder decoder_;
   AsyncCompileJob* job_;
   std::unique_ptr<ModuleCompiler::CompilationUnitBuilder>
@@ -3498,17 +3622,25 @@ bool AsyncStreamingProcessor::ProcessFunctionBody(Vector<const uint8_t> bytes,
     WasmName name = {nullptr, 0};
     compilation_unit_builder_->AddUnit(job_->module_env_.get(), func, offset,
                                        bytes, name);
+    if (compilation_unit_builder_->size() >= kMaxBufferedUnits) {
+      CommitCompilationUnits();
+    }
   }
   ++next_function_;
   return true;
 }
 
+void AsyncStreamingProcessor::CommitCompilationUnits() {
+  DCHECK(compilation_unit_builder_);
+  job_->counters()->wasm_streamed_units_committed()->Increment(
+      static_cast<int>(compilation_unit_builder_->size()));
+  compilation_unit_builder_->Commit();
+  job_->RestartBackgroundTasks();
+}
+
 void AsyncStreamingProcessor::OnFinishedChunk() {
   // TRACE_STREAMING("FinishChunk...\n");
-  if (compilation_unit_builder_) {
-    compilation_unit_builder_->Commit();
-    job_->RestartBackgroundTasks();
-  }
+  if (compilation_unit_builder_) CommitCompilationUnits();
 }
 
 // Finish the processing of the stream.
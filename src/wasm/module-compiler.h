@@ -60,6 +60,29 @@ V8_EXPORT_PRIVATE void AsyncInstantiate(Isolate* isolate,
 // Illegal builtin will never be called.
 Handle<Code> CompileLazy(Isolate* isolate);
 
+// Isolate-wide cache of JS-to-wasm wrappers, keyed by canonical signature, so
+// that modules with identical export signatures share one compiled wrapper.
+// The cached wrappers have no WasmContext bound and call the Illegal builtin;
+// {GetWrapper} hands out a copy which is patched to call {wasm_code}. The
+// WasmContext reference is specialized per instance like all module code.
+class JSToWasmWrapperTemplates {
+ public:
+  explicit JSToWasmWrapperTemplates(AccountingAllocator* allocator);
+
+  Handle<Code> GetWrapper(Isolate*, WasmModule*, Handle<Code> wasm_code,
+                          uint32_t index);
+
+  size_t size() const { return templates_.size(); }
+
+ private:
+  // Owns copies of the cached signatures, which must outlive their modules.
+  Zone zone_;
+  // Maps signatures to an index in {templates_}.
+  SignatureMap sig_map_;
+  // Global handles to the cached wrapper code.
+  std::vector<Handle<Code>> templates_;
+};
+
 // This class orchestrates the lazy compilation of wasm functions. It is
 // triggered by the WasmCompileLazy builtin.
 // It contains the logic for compiling and specializing wasm functions, and
@@ -69,6 +92,8 @@ Handle<Code> CompileLazy(Isolate* isolate);
 // TODO(clemensh): Implement concurrent lazy compilation.
 class LazyCompilationOrchestrator {
   void CompileFunction(Isolate*, Handle<WasmInstanceObject>, int func_index);
+  bool DeserializeFunction(Isolate*, Handle<WasmInstanceObject>,
+                           int func_index);
 
  public:
   Handle<Code> CompileLazy(Isolate*, Handle<WasmInstanceObject>,
@@ -23,6 +23,12 @@ int ExtractDirectCallIndex(wasm::Decoder& decoder, const byte* pc);
 //
 // Set up all relocations / patching that should be performed by the Relocate* /
 // Patch* methods, then apply all changes in one step using the Apply* methods.
+//
+// Memory, globals and the table size are already reached through the
+// WasmContext. Wasm code can only be shared between instances once the
+// remaining instance-specific references are gone as well: the address of the
+// WasmContext itself (WASM_CONTEXT_REFERENCE), direct call targets
+// (CODE_TARGET) and function and signature table handles (WASM_GLOBAL_HANDLE).
 class CodeSpecialization {
  public:
   CodeSpecialization(Isolate*, Zone*);
@@ -30,9 +36,6 @@ class CodeSpecialization {
 
   // Update WasmContext references.
   void RelocateWasmContextReferences(Address new_context);
-  // Update function table size.
-  // TODO(wasm): Prepare this for more than one indirect function table.
-  void PatchTableSize(uint32_t old_size, uint32_t new_size);
   // Update all direct call sites based on the code table in the given instance.
   void RelocateDirectCalls(Handle<WasmInstanceObject> instance);
   // Relocate an arbitrary object (e.g. function table).
@@ -48,9 +51,6 @@ class CodeSpecialization {
  private:
   Address new_wasm_context_address = 0;
 
-  uint32_t old_function_table_size = 0;
-  uint32_t new_function_table_size = 0;
-
   Handle<WasmInstanceObject> relocate_direct_calls_instance;
 
   std::map<Address, Address> pointers_to_relocate;
@@ -224,6 +224,14 @@ void float64_pow_wrapper(double* param0, double* param1) {
   WriteDoubleValue(param0, Pow(x, y));
 }
 
+void memory_copy_wrapper(uint8_t* dst, uint8_t* src, uint32_t size) {
+  memmove(dst, src, size);
+}
+
+void memory_fill_wrapper(uint8_t* dst, uint32_t value, uint32_t size) {
+  memset(dst, static_cast<uint8_t>(value), size);
+}
+
 void set_thread_in_wasm_flag() { trap_handler::SetThreadInWasm(); }
 
 void clear_thread_in_wasm_flag() { trap_handler::ClearThreadInWasm(); }
@@ -61,6 +61,10 @@ uint32_t word64_popcnt_wrapper(uint64_t* input);
 
 void float64_pow_wrapper(double* param0, double* param1);
 
+void memory_copy_wrapper(uint8_t* dst, uint8_t* src, uint32_t size);
+
+void memory_fill_wrapper(uint8_t* dst, uint32_t value, uint32_t size);
+
 void set_thread_in_wasm_flag();
 void clear_thread_in_wasm_flag();
 
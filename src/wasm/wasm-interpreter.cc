@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
 #include <type_traits>
 
 #include "src/wasm/wasm-interpreter.h"
@@ -667,13 +668,16 @@ struct InterpreterCode {
 // be directly executed without the need to dynamically track blocks.
 class SideTable : public ZoneObject {
  public:
-  ControlTransferMap map_;
+  // The control transfers, sorted by bytecode offset. A flat array is more
+  // compact than a tree and makes the lookup on every branch cache friendly.
+  ZoneVector<std::pair<pc_t, ControlTransferEntry>> entries_;
   uint32_t max_stack_height_;
 
   SideTable(Zone* zone, const WasmModule* module, InterpreterCode* code)
-      : map_(zone), max_stack_height_(0) {
+      : entries_(zone), max_stack_height_(0) {
     // Create a zone for all temporary objects.
     Zone control_transfer_zone(zone->allocator(), ZONE_NAME);
+    ControlTransferMap map(&control_transfer_zone);
 
     // Represents a control flow label.
     class CLabel : public ZoneObject {
@@ -840,7 +844,7 @@ class SideTable : public ZoneObject {
           }
           DCHECK_NOT_NULL(c->else_label);
           c->else_label->Bind(i.pc() + 1);
-          c->else_label->Finish(&map_, code->orig_start);
+          c->else_label->Finish(&map, code->orig_start);
           c->else_label = nullptr;
           DCHECK_GE(stack_height, c->end_label->target_stack_height);
           stack_height = c->end_label->target_stack_height;
@@ -855,7 +859,7 @@ class SideTable : public ZoneObject {
             if (c->else_label) c->else_label->Bind(i.pc());
             c->end_label->Bind(i.pc() + 1);
           }
-          c->Finish(&map_, code->orig_start);
+          c->Finish(&map, code->orig_start);
           DCHECK_GE(stack_height, c->end_label->target_stack_height);
           stack_height = c->end_label->target_stack_height + c->exit_arity;
           control_stack.pop_back();
@@ -899,11 +903,16 @@ class SideTable : public ZoneObject {
     }
     DCHECK_EQ(0, control_stack.size());
     DCHECK_EQ(func_arity, stack_height);
+    entries_.assign(map.begin(), map.end());
   }
 
   ControlTransferEntry& Lookup(pc_t from) {
-    auto result = map_.find(from);
-    DCHECK(result != map_.end());
+    auto result = std::lower_bound(
+        entries_.begin(), entries_.end(), from,
+        [](const std::pair<pc_t, ControlTransferEntry>& entry, pc_t pc) {
+          return entry.first < pc;
+        });
+    DCHECK(result != entries_.end() && result->first == from);
     return result->second;
   }
 };
@@ -1516,6 +1525,43 @@ class ThreadImpl {
     return true;
   }
 
+  bool ExecuteNumericOp(Decoder* decoder, InterpreterCode* code, pc_t pc,
+                        int& len) {
+    WasmOpcode opcode =
+        static_cast<WasmOpcode>(kNumericPrefix << 8 | code->start[pc + 1]);
+    MemoryIndexOperand<Decoder::kNoValidate> operand(decoder,
+                                                     code->at(pc + 1));
+    len = 2 + operand.length;
+    uint32_t size = Pop().to<uint32_t>();
+    uint32_t mem_size = wasm_context_->mem_size;
+    byte* mem_start = wasm_context_->mem_start;
+    switch (opcode) {
+      case kExprMemoryCopy: {
+        uint32_t src = Pop().to<uint32_t>();
+        uint32_t dst = Pop().to<uint32_t>();
+        if (size > mem_size || dst > mem_size - size ||
+            src > mem_size - size) {
+          DoTrap(kTrapMemOutOfBounds, pc);
+          return false;
+        }
+        memmove(mem_start + dst, mem_start + src, size);
+        return true;
+      }
+      case kExprMemoryFill: {
+        uint32_t value = Pop().to<uint32_t>();
+        uint32_t dst = Pop().to<uint32_t>();
+        if (size > mem_size || dst > mem_size - size) {
+          DoTrap(kTrapMemOutOfBounds, pc);
+          return false;
+        }
+        memset(mem_start + dst, static_cast<byte>(value), size);
+        return true;
+      }
+      default:
+        UNREACHABLE();
+    }
+  }
+
   // Check if our control stack (frames_) exceeds the limit. Trigger stack
   // overflow if it does, and unwinding the current frame.
   // Returns true if execution can continue, false if the current activation was
@@ -1956,6 +2002,10 @@ class ThreadImpl {
           len = 1 + operand.length;
           break;
         }
+        case kNumericPrefix: {
+          if (!ExecuteNumericOp(&decoder, code, pc, len)) return;
+          break;
+        }
         // We need to treat kExprI32ReinterpretF32 and kExprI64ReinterpretF64
         // specially to guarantee that the quiet bit of a NaN is preserved on
         // ia32 by the reinterpret casts.
@@ -2681,7 +2731,9 @@ ControlTransferMap WasmInterpreter::ComputeControlTransfersForTesting(
 
   // Now compute and return the control transfers.
   SideTable side_table(zone, module, &code);
-  return side_table.map_;
+  ControlTransferMap map(zone);
+  map.insert(side_table.entries_.begin(), side_table.entries_.end());
+  return map;
 }
 
 //============================================================================
@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include "src/wasm/wasm-memory.h"
+#include "src/counters.h"
 #include "src/objects-inl.h"
 #include "src/wasm/wasm-limits.h"
 #include "src/wasm/wasm-module.h"
@@ -11,6 +12,51 @@ namespace v8 {
 namespace internal {
 namespace wasm {
 
+void* GuardRegionPool::TryTake(size_t length) {
+  base::LockGuard<base::Mutex> lock(&mutex_);
+  // Hand out the most recently returned region first.
+  for (auto it = regions_.rbegin(); it != regions_.rend(); ++it) {
+    if (it->length != length) continue;
+    void* base = it->base;
+    regions_.erase(std::next(it).base());
+    return base;
+  }
+  return nullptr;
+}
+
+bool GuardRegionPool::TryReturn(v8::ArrayBuffer::Allocator* allocator,
+                                void* base, size_t length,
+                                size_t accessible_length) {
+  const size_t max_size = static_cast<size_t>(FLAG_wasm_guard_region_pool_size);
+  {
+    base::LockGuard<base::Mutex> lock(&mutex_);
+    if (regions_.size() >= max_size) return false;
+  }
+  // Clear and protect the accessible part outside of the lock, so that the
+  // next instance finds the whole region inaccessible and zeroed, just like a
+  // fresh reservation.
+  memset(base, 0, accessible_length);
+  allocator->SetProtection(base, accessible_length,
+                           v8::ArrayBuffer::Allocator::Protection::kNoAccess);
+  base::LockGuard<base::Mutex> lock(&mutex_);
+  if (regions_.size() >= max_size) {
+    allocator->Free(base, length,
+                    v8::ArrayBuffer::Allocator::AllocationMode::kReservation);
+    return true;
+  }
+  regions_.push_back({base, length});
+  return true;
+}
+
+void GuardRegionPool::TearDown(v8::ArrayBuffer::Allocator* allocator) {
+  base::LockGuard<base::Mutex> lock(&mutex_);
+  for (const Region& region : regions_) {
+    allocator->Free(region.base, region.length,
+                    v8::ArrayBuffer::Allocator::AllocationMode::kReservation);
+  }
+  regions_.clear();
+}
+
 void* TryAllocateBackingStore(Isolate* isolate, size_t size,
                               bool enable_guard_regions, void*& allocation_base,
                               size_t& allocation_length) {
@@ -27,11 +73,19 @@ void* TryAllocateBackingStore(Isolate* isolate, size_t size,
     allocation_length = RoundUp(kWasmMaxHeapOffset, base::OS::CommitPageSize());
     DCHECK_EQ(0, size % base::OS::CommitPageSize());
 
-    // AllocateGuarded makes the whole region inaccessible by default.
+    // Prefer a reservation released by an earlier instance; either way the
+    // whole region starts out inaccessible.
     allocation_base =
-        isolate->array_buffer_allocator()->Reserve(allocation_length);
-    if (allocation_base == nullptr) {
-      return nullptr;
+        isolate->wasm_guard_region_pool()->TryTake(allocation_length);
+    if (allocation_base != nullptr) {
+      isolate->counters()->wasm_guard_regions_reused()->Increment();
+    } else {
+      allocation_base =
+          isolate->array_buffer_allocator()->Reserve(allocation_length);
+      if (allocation_base == nullptr) {
+        return nullptr;
+      }
+      isolate->counters()->wasm_guard_regions_reserved()->Increment();
     }
 
     void* memory = allocation_base;
@@ -5,6 +5,9 @@
 #ifndef V8_WASM_MEMORY_H_
 #define V8_WASM_MEMORY_H_
 
+#include <vector>
+
+#include "src/base/platform/mutex.h"
 #include "src/flags.h"
 #include "src/handles.h"
 #include "src/objects/js-array.h"
@@ -13,6 +16,39 @@ namespace v8 {
 namespace internal {
 namespace wasm {
 
+// Keeps released guard region reservations (see {NewArrayBuffer}) around so
+// that later instantiations can reuse the address space instead of reserving
+// a fresh region each time. Pooled regions are zeroed and inaccessible, just
+// like a fresh reservation. The pool is accessed from the GC when array
+// buffers die, hence the mutex.
+class GuardRegionPool {
+ public:
+  GuardRegionPool() = default;
+  ~GuardRegionPool() { DCHECK(regions_.empty()); }
+
+  // Takes a pooled reservation of exactly {length} bytes, or returns nullptr.
+  void* TryTake(size_t length);
+  // Clears and protects the first {accessible_length} bytes of the
+  // reservation of {length} bytes at {base} through {allocator} and keeps it
+  // for reuse. Returns false, leaving the region untouched, if the pool is
+  // full. Otherwise the pool takes ownership of the region.
+  bool TryReturn(v8::ArrayBuffer::Allocator* allocator, void* base,
+                 size_t length, size_t accessible_length);
+  // Frees all pooled reservations.
+  void TearDown(v8::ArrayBuffer::Allocator* allocator);
+
+ private:
+  struct Region {
+    void* base;
+    size_t length;
+  };
+
+  base::Mutex mutex_;
+  std::vector<Region> regions_;
+
+  DISALLOW_COPY_AND_ASSIGN(GuardRegionPool);
+};
+
 Handle<JSArrayBuffer> NewArrayBuffer(
     Isolate*, size_t size, bool enable_guard_regions,
     SharedFlag shared = SharedFlag::kNotShared);
@@ -288,6 +288,7 @@ void UpdateDispatchTables(Isolate* isolate, Handle<FixedArray> dispatch_tables,
 
 void UnpackAndRegisterProtectedInstructions(Isolate* isolate,
                                             Handle<FixedArray> code_table);
+void UnpackAndRegisterProtectedInstructions(Isolate* isolate, Code* code);
 
 const char* ExternalKindName(WasmExternalKind);
 
@@ -264,6 +264,9 @@ void WasmTableObject::Grow(Isolate* isolate, uint32_t count) {
                                                    &specialization_zone);
       WasmInstanceObject* instance =
           WasmInstanceObject::cast(dispatch_tables->get(i));
+      // Indirect calls load the table size from the WasmContext.
+      DCHECK_EQ(0, table_index);
+      instance->wasm_context()->get()->function_table_size = old_size + count;
       WasmCompiledModule* compiled_module = instance->compiled_module();
       GlobalHandleAddress old_function_table_addr =
           WasmCompiledModule::GetTableValue(
@@ -271,7 +274,6 @@ void WasmTableObject::Grow(Isolate* isolate, uint32_t count) {
       GlobalHandleAddress old_signature_table_addr =
           WasmCompiledModule::GetTableValue(
               compiled_module->ptr_to_signature_tables(), table_index);
-      code_specialization.PatchTableSize(old_size, old_size + count);
       code_specialization.RelocatePointer(old_function_table_addr,
                                           new_function_table_addr);
       code_specialization.RelocatePointer(old_signature_table_addr,
@@ -526,6 +528,7 @@ Handle<WasmInstanceObject> WasmInstanceObject::New(
   wasm_context->get()->mem_start = nullptr;
   wasm_context->get()->mem_size = 0;
   wasm_context->get()->globals_start = nullptr;
+  wasm_context->get()->function_table_size = 0;
   instance->set_wasm_context(*wasm_context);
 
   instance->set_compiled_module(*compiled_module);
@@ -53,15 +53,18 @@ class WasmInstanceObject;
       kSize + (k##name##Index - kFieldCount) * kPointerSize;
 
 // Wasm context used to store the mem_size and mem_start address of the linear
-// memory. These variables can be accessed at C++ level at graph build time
+// memory, the start of the globals and the size of the indirect function
+// table. These variables can be accessed at C++ level at graph build time
 // (e.g., initialized during instance building / changed at runtime by
-// grow_memory). The address of the WasmContext is provided to the wasm entry
-// functions using a RelocatableIntPtrConstant, then the address is passed as
-// parameter to the other wasm functions.
+// grow_memory or table growth). The address of the WasmContext is provided to
+// the wasm entry functions using a RelocatableIntPtrConstant, then the address
+// is passed as parameter to the other wasm functions.
 struct WasmContext {
   byte* mem_start;
   uint32_t mem_size;
   byte* globals_start;
+  // TODO(wasm): Prepare this for more than one indirect function table.
+  uint32_t function_table_size;
 };
 
 // Representation of a WebAssembly.Module JavaScript-level object.
@@ -396,7 +399,8 @@ class WasmCompiledModule : public FixedArray {
   MACRO(WEAK_LINK, WasmCompiledModule, next_instance)         \
   MACRO(WEAK_LINK, WasmCompiledModule, prev_instance)         \
   MACRO(WEAK_LINK, JSObject, owning_instance)                 \
-  MACRO(WEAK_LINK, WasmModuleObject, wasm_module)
+  MACRO(WEAK_LINK, WasmModuleObject, wasm_module)             \
+  MACRO(OBJECT, ByteArray, lazy_function_data)
 
 #if DEBUG
 #define DEBUG_ONLY_TABLE(MACRO) MACRO(SMALL_CONST_NUMBER, uint32_t, instance_id)
@@ -245,6 +245,10 @@ const char* WasmOpcodes::OpcodeName(WasmOpcode opcode) {
     CASE_U32_OP(AtomicExchange, "atomic_xchng")
     CASE_U32_OP(AtomicCompareExchange, "atomic_cmpxchng")
 
+    // Bulk memory operations.
+    CASE_OP(MemoryCopy, "memory.copy")
+    CASE_OP(MemoryFill, "memory.fill")
+
     default : return "unknown";
     // clang-format on
   }
@@ -444,6 +444,11 @@ constexpr WasmCodePosition kNoCodePosition = -1;
   V(I32AtomicCompareExchange8U, 0xfe4a, i_iii) \
   V(I32AtomicCompareExchange16U, 0xfe4b, i_iii)
 
+// Bulk memory opcodes. Both take a reserved memory index immediate.
+#define FOREACH_NUMERIC_OPCODE(V) \
+  V(MemoryCopy, 0xfc0a, _)        \
+  V(MemoryFill, 0xfc0b, _)
+
 // All opcodes.
 #define FOREACH_OPCODE(V)             \
   FOREACH_CONTROL_OPCODE(V)           \
@@ -457,7 +462,8 @@ constexpr WasmCodePosition kNoCodePosition = -1;
   FOREACH_SIMD_1_OPERAND_OPCODE(V)    \
   FOREACH_SIMD_MASK_OPERAND_OPCODE(V) \
   FOREACH_SIMD_MEM_OPCODE(V)          \
-  FOREACH_ATOMIC_OPCODE(V)
+  FOREACH_ATOMIC_OPCODE(V)            \
+  FOREACH_NUMERIC_OPCODE(V)
 
 // All signatures.
 #define FOREACH_SIGNATURE(V)            \
@@ -501,6 +507,7 @@ constexpr WasmCodePosition kNoCodePosition = -1;
   V(s_sss, kWasmS128, kWasmS128, kWasmS128, kWasmS128)
 
 #define FOREACH_PREFIX(V) \
+  V(Numeric, 0xfc)        \
   V(Simd, 0xfd)           \
   V(Atomic, 0xfe)
 
@@ -193,6 +193,19 @@ void PrintWasmText(const WasmModule* module, const ModuleWireBytes& wire_bytes,
       case kExprSelect:
         os << WasmOpcodes::OpcodeName(opcode);
         break;
+      case kNumericPrefix: {
+        WasmOpcode numeric_opcode = i.prefixed_opcode();
+        switch (numeric_opcode) {
+          FOREACH_NUMERIC_OPCODE(CASE_OPCODE) {
+            os << WasmOpcodes::OpcodeName(numeric_opcode);
+            break;
+          }
+          default:
+            UNREACHABLE();
+            break;
+        }
+        break;
+      }
       case kAtomicPrefix: {
         WasmOpcode atomic_opcode = i.prefixed_opcode();
         switch (atomic_opcode) {
@@ -1302,6 +1302,92 @@ TEST(TestUseOfIncrementalBarrierOnCompileLazy) {
   CHECK(g_function->is_compiled());
 }
 
+TEST(BytecodeFlushing) {
+  FLAG_flush_bytecode = true;
+  FLAG_always_opt = false;
+  FLAG_opt = false;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  v8::HandleScope scope(CcTest::isolate());
+
+  CompileRun(
+      "function foo() {"
+      "  var x = 42;"
+      "  var y = x * 2;"
+      "  return y + 1;"
+      "}"
+      "foo();");
+
+  Handle<String> foo_name = factory->InternalizeUtf8String("foo");
+  Handle<Object> func_value =
+      Object::GetProperty(isolate->global_object(), foo_name)
+          .ToHandleChecked();
+  CHECK(func_value->IsJSFunction());
+  Handle<JSFunction> function = Handle<JSFunction>::cast(func_value);
+  CHECK(function->shared()->HasBytecodeArray());
+  CHECK(function->is_compiled());
+
+  // Every full GC ages the bytecode, it is flushed once it has grown old.
+  for (int i = 0; i < BytecodeArray::kIsOldBytecodeAge; i++) {
+    CcTest::CollectAllGarbage();
+    CHECK(function->shared()->is_compiled());
+  }
+  CcTest::CollectAllGarbage();
+  CHECK(!function->shared()->is_compiled());
+  CHECK(!function->is_compiled());
+
+  v8::HeapStatistics heap_statistics;
+  CcTest::isolate()->GetHeapStatistics(&heap_statistics);
+  CHECK_LT(0, heap_statistics.flushed_bytecode_size());
+
+  // The function is compiled lazily again on the next call.
+  v8::Local<v8::Context> context = CcTest::isolate()->GetCurrentContext();
+  CHECK_EQ(85, CompileRun("foo();")->Int32Value(context).FromJust());
+  CHECK(function->shared()->HasBytecodeArray());
+  CHECK(function->is_compiled());
+}
+
+TEST(BytecodeFlushingKeepsReachableBytecode) {
+  FLAG_flush_bytecode = true;
+  FLAG_always_opt = false;
+  FLAG_opt = false;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  v8::HandleScope scope(CcTest::isolate());
+
+  CompileRun(
+      "function bar() {"
+      "  var x = 42;"
+      "  return x + 1;"
+      "}"
+      "bar();");
+
+  Handle<String> bar_name = factory->InternalizeUtf8String("bar");
+  Handle<Object> func_value =
+      Object::GetProperty(isolate->global_object(), bar_name)
+          .ToHandleChecked();
+  CHECK(func_value->IsJSFunction());
+  Handle<JSFunction> function = Handle<JSFunction>::cast(func_value);
+  Handle<BytecodeArray> bytecode(function->shared()->bytecode_array());
+
+  // Old bytecode that is still reachable from elsewhere is neither flushed
+  // nor counted.
+  v8::HeapStatistics heap_statistics;
+  CcTest::isolate()->GetHeapStatistics(&heap_statistics);
+  size_t flushed_bytecode_size = heap_statistics.flushed_bytecode_size();
+  for (int i = 0; i <= BytecodeArray::kIsOldBytecodeAge; i++) {
+    CcTest::CollectAllGarbage();
+  }
+  CHECK(bytecode->IsOld());
+  CHECK(function->shared()->HasBytecodeArray());
+  CHECK_EQ(*bytecode, function->shared()->bytecode_array());
+  CHECK(function->is_compiled());
+  CcTest::isolate()->GetHeapStatistics(&heap_statistics);
+  CHECK_EQ(flushed_bytecode_size, heap_statistics.flushed_bytecode_size());
+}
+
 TEST(CompilationCacheCachingBehavior) {
   // If we do not have the compilation cache turned off, this test is invalid.
   if (!FLAG_compilation_cache) {
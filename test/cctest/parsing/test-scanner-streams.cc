@@ -243,6 +243,42 @@ TEST(Utf8SingleByteChunks) {
   }
 }
 
+TEST(Utf8AsciiRunsAcrossBuffers) {
+  // Long ASCII runs around non-ASCII characters, so that the ASCII fast path
+  // has to stop at buffer ends and at incomplete characters at chunk ends.
+  std::string utf8;
+  std::vector<uint16_t> ucs2;
+  for (int run = 0; run < 4; run++) {
+    for (int i = 0; i < 700 + run * 3; i++) {
+      char c = static_cast<char>('a' + (i % 26));
+      utf8 += c;
+      ucs2.push_back(c);
+    }
+    utf8 += unicode_utf8;
+    for (size_t i = 0; unicode_ucs2[i]; i++) ucs2.push_back(unicode_ucs2[i]);
+  }
+
+  for (bool extra_chunky : {false, true}) {
+    ChunkSource chunk_source(reinterpret_cast<const uint8_t*>(utf8.data()),
+                             utf8.size(), extra_chunky);
+    std::unique_ptr<v8::internal::Utf16CharacterStream> stream(
+        v8::internal::ScannerStream::For(
+            &chunk_source, v8::ScriptCompiler::StreamedSource::UTF8, nullptr));
+
+    for (size_t i = 0; i < ucs2.size(); i++) {
+      CHECK_EQ(ucs2[i], stream->Advance());
+    }
+    CHECK_EQ(v8::internal::Utf16CharacterStream::kEndOfInput,
+             stream->Advance());
+
+    // Seeking backwards re-positions within already fetched chunks.
+    for (size_t pos : {ucs2.size() / 3, size_t{5}, ucs2.size() - 2}) {
+      stream->Seek(pos);
+      CHECK_EQ(ucs2[pos], stream->Advance());
+    }
+  }
+}
+
 #define CHECK_EQU(v1, v2) CHECK_EQ(static_cast<int>(v1), static_cast<int>(v2))
 
 void TestCharacterStream(const char* reference, i::Utf16CharacterStream* stream,
@@ -135,5 +135,28 @@ TEST(ContextualKeywordTokens) {
   CHECK_TOK(Token::UNINITIALIZED, scanner->current_contextual_token());
 }
 
+TEST(SkipLoopsAcrossBufferBoundaries) {
+  // Comments, identifiers and strings longer than the character stream's
+  // buffer, so that the skip loops have to refill it.
+  std::string comment(1000, 'x');
+  std::string identifier = "b" + std::string(700, 'a') + "Z$";
+  std::string string_body = std::string(900, 'c') + "\\n" + "\u00e4";
+  std::string src = "// " + comment + "\nvar " + identifier + " = '" +
+                    string_body + "'; /* " + comment + " */";
+  auto scanner = make_scanner(src.c_str());
+
+  CHECK(scanner->HasAnyLineTerminatorBeforeNext());
+  CHECK_TOK(Token::VAR, scanner->Next());
+  CHECK_TOK(Token::IDENTIFIER, scanner->Next());
+  CHECK_EQ(static_cast<int>(identifier.length()),
+           scanner->location().end_pos - scanner->location().beg_pos);
+  CHECK_TOK(Token::ASSIGN, scanner->Next());
+  CHECK_TOK(Token::STRING, scanner->Next());
+  CHECK_EQ(static_cast<int>(string_body.length()) + 2,
+           scanner->location().end_pos - scanner->location().beg_pos);
+  CHECK_TOK(Token::SEMICOLON, scanner->Next());
+  CHECK_TOK(Token::EOS, scanner->Next());
+}
+
 }  // namespace internal
 }  // namespace v8
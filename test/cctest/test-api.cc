@@ -25098,6 +25098,73 @@ TEST(StreamingBiggerScript) {
 }
 
 
+TEST(StreamingScriptBackgroundCompile) {
+  // Bytecode for the top-level code and the eagerly compiled inner function is
+  // generated by the streaming task; only finalization happens in Compile.
+  i::FLAG_background_compile = true;
+  const char* chunks[] = {"var s = 'str'; var a = (function() { return 6; })",
+                          "(); function foo() { return a + s.length + 4; }",
+                          " foo();", nullptr};
+  RunStreamingTest(chunks);
+}
+
+class StreamingTaskThread : public v8::base::Thread {
+ public:
+  explicit StreamingTaskThread(v8::ScriptCompiler::ScriptStreamingTask* task)
+      : Thread(Options("StreamingTaskThread")), task_(task) {}
+
+  void Run() { task_->Run(); }
+
+ private:
+  v8::ScriptCompiler::ScriptStreamingTask* task_;
+};
+
+TEST(StreamingAsmJsWarningBackgroundCompile) {
+  // An eager asm.js module which fails validation on the streaming thread is
+  // compiled to bytecode there, the warning is reported when compiling.
+  i::FLAG_background_compile = true;
+  i::FLAG_validate_asm = true;
+  if (i::FLAG_suppress_asm_messages) return;
+
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  asm_warning_triggered = 0;
+  isolate->AddMessageListenerWithErrorLevel(AsmJsWarningListener,
+                                            v8::Isolate::kMessageAll);
+  const char* chunks[] = {"var m = (function module() {\n",
+                          "  'use asm';\n"
+                          "  var x = 'hi';\n"
+                          "  return {};\n"
+                          "});\n",
+                          "m(); 13;", nullptr};
+  v8::ScriptCompiler::StreamedSource source(
+      new TestSourceStream(chunks),
+      v8::ScriptCompiler::StreamedSource::ONE_BYTE);
+  v8::ScriptCompiler::ScriptStreamingTask* task =
+      v8::ScriptCompiler::StartStreamingScript(isolate, &source);
+  StreamingTaskThread thread(task);
+  thread.Start();
+  thread.Join();
+  delete task;
+  CHECK_EQ(0, asm_warning_triggered);
+
+  v8::ScriptOrigin origin(v8_str("http://foo.com"));
+  char* full_source = TestSourceStream::FullSourceString(chunks);
+  v8::Local<Script> script =
+      v8::ScriptCompiler::Compile(env.local(), &source, v8_str(full_source),
+                                  origin)
+          .ToLocalChecked();
+  CHECK_EQ(1, asm_warning_triggered);
+  CHECK_EQ(13, script->Run(env.local())
+                   .ToLocalChecked()
+                   ->Int32Value(env.local())
+                   .FromJust());
+  isolate->RemoveMessageListeners(AsmJsWarningListener);
+  delete[] full_source;
+}
+
 TEST(StreamingScriptWithParseError) {
   // Test that parse errors from streamed scripts are propagated correctly.
   {
@@ -36,6 +36,7 @@
 #include "src/factory.h"
 #include "src/interpreter/interpreter.h"
 #include "src/objects-inl.h"
+#include "src/source-position-table.h"
 #include "test/cctest/cctest.h"
 
 namespace v8 {
@@ -654,5 +655,117 @@ TEST(InvocationCount) {
   CHECK_EQ(4, foo->feedback_vector()->invocation_count());
 }
 
+TEST(LazySourcePositions) {
+  FLAG_enable_lazy_source_positions = true;
+  FLAG_always_opt = false;
+  CcTest::InitializeVM();
+  LocalContext env;
+  v8::HandleScope scope(CcTest::isolate());
+
+  CompileRun(
+      "function foo() { return 1; }\n"
+      "function thrower() {\n"
+      "  throw new Error('boom');\n"
+      "}\n"
+      "foo();");
+  Handle<JSFunction> foo = Handle<JSFunction>::cast(GetGlobalProperty("foo"));
+  CHECK(foo->shared()->HasBytecodeArray());
+  CHECK(foo->shared()->has_lazy_source_positions());
+  CHECK_EQ(0, foo->shared()->bytecode_array()->SourcePositionTable()->length());
+
+  // Throwing needs the location, which collects the source positions.
+  v8::TryCatch try_catch(CcTest::isolate());
+  CHECK(CompileRun("thrower();").IsEmpty());
+  CHECK(try_catch.HasCaught());
+  CHECK_EQ(3, try_catch.Message()->GetLineNumber(env.local()).FromJust());
+  Handle<JSFunction> thrower =
+      Handle<JSFunction>::cast(GetGlobalProperty("thrower"));
+  CHECK(!thrower->shared()->has_lazy_source_positions());
+  BytecodeArray* bytecode = thrower->shared()->bytecode_array();
+  CHECK_LT(0, bytecode->SourcePositionTable()->length());
+
+  // Functions that never needed their positions are left alone.
+  CHECK(foo->shared()->has_lazy_source_positions());
+}
+
+TEST(LazySourcePositionsOptimized) {
+  if (i::FLAG_always_opt || !i::FLAG_opt) return;
+  FLAG_enable_lazy_source_positions = true;
+  FLAG_allow_natives_syntax = true;
+  FLAG_turbo_inlining = true;
+  CcTest::InitializeVM();
+  if (!CcTest::i_isolate()->use_optimizer()) return;
+  LocalContext env;
+  v8::HandleScope scope(CcTest::isolate());
+
+  CompileRunWithOrigin(
+      "function inlined(x) {\n"
+      "  if (!x) return 1;\n"
+      "  throw new Error('inlined');\n"
+      "}\n"
+      "function optimized(x, y) {\n"
+      "  if (!y) return inlined(x) + 1;\n"
+      "  throw new Error('optimized');\n"
+      "}\n"
+      "optimized(false, false);\n"
+      "optimized(false, false);\n"
+      "%OptimizeFunctionOnNextCall(optimized);\n"
+      "optimized(false, false);\n",
+      "lazy-positions.js");
+  Handle<JSFunction> optimized =
+      Handle<JSFunction>::cast(GetGlobalProperty("optimized"));
+  CHECK(optimized->IsOptimized());
+
+  // The optimized code has positions for its own body and the inlined one.
+  bool has_inlined_position = false;
+  bool has_outer_position = false;
+  for (SourcePositionTableIterator it(optimized->code()->SourcePositionTable());
+       !it.done(); it.Advance()) {
+    if (it.source_position().isInlined()) {
+      has_inlined_position = true;
+    } else {
+      has_outer_position = true;
+    }
+  }
+  CHECK(has_inlined_position);
+  CHECK(has_outer_position);
+
+  v8::Local<v8::Value> stack = CompileRun(
+      "var stack;\n"
+      "try { optimized(true, false); } catch (e) { stack = e.stack; }\n"
+      "stack;");
+  v8::String::Utf8Value inlined_stack(CcTest::isolate(), stack);
+  CHECK_NOT_NULL(strstr(*inlined_stack, "lazy-positions.js:3:9"));
+  CHECK_NOT_NULL(strstr(*inlined_stack, "lazy-positions.js:6:18"));
+
+  stack = CompileRun(
+      "try { optimized(false, true); } catch (e) { stack = e.stack; }\n"
+      "stack;");
+  v8::String::Utf8Value optimized_stack(CcTest::isolate(), stack);
+  CHECK_NOT_NULL(strstr(*optimized_stack, "lazy-positions.js:7:9"));
+}
+
+TEST(LazySourcePositionsAtStackOverflow) {
+  FLAG_enable_lazy_source_positions = true;
+  FLAG_always_opt = false;
+  CcTest::InitializeVM();
+  LocalContext env;
+  v8::HandleScope scope(CcTest::isolate());
+
+  // The stack trace of the RangeError is captured at the stack limit, where
+  // the positions of the recursing function cannot be collected.
+  v8::Local<v8::Value> result = CompileRun(
+      "function recurse() { return recurse() + 1; }\n"
+      "var caught;\n"
+      "try { recurse(); } catch (e) { caught = e; }\n"
+      "caught instanceof RangeError && typeof caught.stack === 'string';");
+  CHECK(result->IsTrue());
+  Handle<JSFunction> recurse =
+      Handle<JSFunction>::cast(GetGlobalProperty("recurse"));
+  CHECK(!CcTest::i_isolate()->has_pending_exception());
+  CHECK(!CcTest::i_isolate()->collecting_source_positions());
+  CHECK(recurse->shared()->HasBytecodeArray());
+}
+
 }  // namespace internal
 }  // namespace v8
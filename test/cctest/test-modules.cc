@@ -281,4 +281,65 @@ TEST(ModuleEvaluationCompletion2) {
   CHECK(!try_catch.HasCaught());
 }
 
+static Local<Module>* g_batch_modules = nullptr;
+static MaybeLocal<Module> BatchResolveCallback(Local<Context> context,
+                                               Local<String> specifier,
+                                               Local<Module> referrer) {
+  CHECK(specifier->StrictEquals(v8_str("b.js")));
+  return g_batch_modules[1];
+}
+
+TEST(ModuleBatchCompilation) {
+  Isolate* isolate = CcTest::isolate();
+  HandleScope scope(isolate);
+  LocalContext env;
+  v8::TryCatch try_catch(isolate);
+
+  // The second source is two-byte.
+  ScriptCompiler::Source a(
+      v8_str("import {x} from 'b.js'; Object.batch = x + 1;"),
+      ModuleOrigin(v8_str("a.js"), isolate));
+  ScriptCompiler::Source b(
+      v8_str("export let x = '\xc3\xa9\xe4\xb8\x96'.length;"),
+      ModuleOrigin(v8_str("b.js"), isolate));
+  ScriptCompiler::Source* sources[] = {&a, &b};
+  Local<Module> modules[2];
+  CHECK(ScriptCompiler::CompileModules(isolate, 2, sources, modules)
+            .FromJust());
+  CHECK_EQ(1, modules[0]->GetModuleRequestsLength());
+  CHECK_EQ(0, modules[1]->GetModuleRequestsLength());
+
+  g_batch_modules = modules;
+  CHECK(modules[0]
+            ->InstantiateModule(env.local(), BatchResolveCallback)
+            .FromJust());
+  g_batch_modules = nullptr;
+  CHECK(!modules[0]->Evaluate(env.local()).IsEmpty());
+  ExpectInt32("Object.batch", 3);
+
+  CHECK(!try_catch.HasCaught());
+}
+
+TEST(ModuleBatchCompilationError) {
+  Isolate* isolate = CcTest::isolate();
+  HandleScope scope(isolate);
+  LocalContext env;
+
+  ScriptCompiler::Source a(v8_str("export let a = 1;"),
+                           ModuleOrigin(v8_str("a.js"), isolate));
+  ScriptCompiler::Source b(v8_str("export let = ;"),
+                           ModuleOrigin(v8_str("b.js"), isolate));
+  ScriptCompiler::Source c(v8_str("export let c = 1;"),
+                           ModuleOrigin(v8_str("c.js"), isolate));
+  ScriptCompiler::Source* sources[] = {&a, &b, &c};
+  Local<Module> modules[3];
+  v8::TryCatch try_catch(isolate);
+  CHECK(ScriptCompiler::CompileModules(isolate, 3, sources, modules)
+            .IsNothing());
+  CHECK(try_catch.HasCaught());
+  CHECK(try_catch.Exception()->IsNativeError());
+  CHECK(!modules[0].IsEmpty());
+  CHECK(modules[2].IsEmpty());
+}
+
 }  // anonymous namespace
@@ -886,6 +886,41 @@ TEST(ScopeUsesArgumentsSuperThis) {
   }
 }
 
+TEST(PredictiveCompileHints) {
+  i::FLAG_predictive_compile = true;
+  i::FLAG_lazy = true;
+  v8::V8::Initialize();
+  HandleAndZoneScope handles;
+
+  i::Isolate* isolate = CcTest::i_isolate();
+  i::Factory* factory = isolate->factory();
+
+  // a and b are called from the top-level code, c is only referenced and d
+  // is only called from within another function.
+  const char* source =
+      "function a() {} function b() {} function c() {}\n"
+      "function d() {} a(); var x = b(); var y = c;\n"
+      "(function() { d(); })();";
+  i::Handle<i::String> source_code =
+      factory->NewStringFromUtf8(i::CStrVector(source)).ToHandleChecked();
+  i::Handle<i::Script> script = factory->NewScript(source_code);
+
+  i::ParseInfo info(script);
+  info.set_toplevel(true);
+  CHECK(i::parsing::ParseProgram(&info, isolate));
+
+  int num_predicted = 0;
+  for (i::Declaration* decl : *info.scope()->declarations()) {
+    if (!decl->IsFunctionDeclaration()) continue;
+    const i::AstRawString* name = decl->proxy()->raw_name();
+    bool expected = name->IsOneByteEqualTo("a") || name->IsOneByteEqualTo("b");
+    i::FunctionLiteral* fun = decl->AsFunctionDeclaration()->fun();
+    CHECK_EQ(expected, fun->should_compile_in_background());
+    if (expected) num_predicted++;
+  }
+  CHECK_EQ(2, num_predicted);
+}
+
 static void CheckParsesToNumber(const char* source) {
   v8::V8::Initialize();
   HandleAndZoneScope handles;
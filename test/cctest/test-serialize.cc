@@ -1907,6 +1907,73 @@ TEST(CodeSerializerIsolates) {
   isolate2->Dispose();
 }
 
+static SharedFunctionInfo* FindSharedFunctionInfo(
+    v8::Local<v8::UnboundScript> script, const char* name) {
+  i::Handle<i::SharedFunctionInfo> sfi = v8::Utils::OpenHandle(*script);
+  i::Handle<i::Script> i_script(Script::cast(sfi->script()));
+  i::SharedFunctionInfo::ScriptIterator iterator(i_script);
+  while (SharedFunctionInfo* next = iterator.Next()) {
+    if (next->name()->IsUtf8EqualTo(CStrVector(name))) return next;
+  }
+  return nullptr;
+}
+
+TEST(CodeSerializerPreParsedScopeData) {
+  FLAG_preparser_scope_analysis = true;
+  // The lazy function f is not in the cache, but the scope data gathered by
+  // preparsing it is. Compiling f after a cache hit skips preparsing g.
+  const char* source =
+      "function f() {"
+      "  var a = 'abc';"
+      "  function g() { return a; }"
+      "  return g();"
+      "}"
+      "f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache = ProduceCache(source);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script;
+    {
+      DisallowCompilation no_compile(reinterpret_cast<Isolate*>(isolate2));
+      script = v8::ScriptCompiler::CompileUnboundScript(
+                   isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+                   .ToLocalChecked();
+    }
+    CHECK(!cache->rejected);
+
+    SharedFunctionInfo* f = FindSharedFunctionInfo(script, "f");
+    CHECK_NOT_NULL(f);
+    CHECK(!f->is_compiled());
+    CHECK(f->HasPreParsedScopeData());
+
+    v8::Local<v8::Value> result = script->BindToCurrentContext()
+                                      ->Run(isolate2->GetCurrentContext())
+                                      .ToLocalChecked();
+    CHECK(result->ToString(isolate2->GetCurrentContext())
+              .ToLocalChecked()
+              ->Equals(isolate2->GetCurrentContext(), v8_str("abcdef"))
+              .FromJust());
+
+    // Compiling f consumed its scope data.
+    f = FindSharedFunctionInfo(script, "f");
+    CHECK(f->is_compiled());
+    CHECK(!f->HasPreParsedScopeData());
+  }
+  isolate2->Dispose();
+  delete cache;
+}
+
 TEST(CodeSerializerIsolatesEager) {
   const char* source =
       "function f() {"
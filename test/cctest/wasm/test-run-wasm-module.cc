@@ -8,6 +8,7 @@
 #include "src/api.h"
 #include "src/objects-inl.h"
 #include "src/snapshot/code-serializer.h"
+#include "src/trap-handler/trap-handler.h"
 #include "src/version.h"
 #include "src/wasm/module-compiler.h"
 #include "src/wasm/module-decoder.h"
@@ -443,6 +444,33 @@ TEST(DeserializeWireBytesAndSerializedDataInvalid) {
   Cleanup();
 }
 
+namespace {
+int lazily_deserialized_functions = 0;
+
+int* LookupLazilyDeserializedFunctions(const char* name) {
+  if (strcmp(name, "c:V8.WasmLazilyDeserializedFunctions") != 0) {
+    return nullptr;
+  }
+  return &lazily_deserialized_functions;
+}
+}  // namespace
+
+TEST(DeserializeFunctionsLazily) {
+  FlagScope<bool> lazy_deserialization(&FLAG_wasm_lazy_deserialization, true);
+  WasmSerializationTest test;
+  {
+    HandleScope scope(test.current_isolate());
+    lazily_deserialized_functions = 0;
+    test.current_isolate_v8()->SetCounterFunction(
+        LookupLazilyDeserializedFunctions);
+    // Calling the exported function deserializes its code.
+    test.DeserializeAndRun();
+    CHECK_EQ(1, lazily_deserialized_functions);
+  }
+  Cleanup(test.current_isolate());
+  Cleanup();
+}
+
 std::unique_ptr<const uint8_t[]> CreatePayload(const uint8_t* start,
                                                size_t size) {
   uint8_t* ret = new uint8_t[size];
@@ -1174,6 +1202,59 @@ TEST(Run_WasmModule_Buffer_Externalized_Detach) {
   Cleanup();
 }
 
+#if V8_TRAP_HANDLER_SUPPORTED
+TEST(Run_WasmModule_GuardRegionIsReused) {
+  {
+    Isolate* isolate = CcTest::InitIsolateOnce();
+    HandleScope scope(isolate);
+    const size_t size = WasmModule::kPageSize;
+    Handle<JSArrayBuffer> buffer = wasm::NewArrayBuffer(isolate, size, true);
+    CHECK(!buffer.is_null());
+    void* const allocation_base = buffer->allocation_base();
+    reinterpret_cast<byte*>(buffer->backing_store())[size - 1] = 42;
+    wasm::DetachMemoryBuffer(isolate, buffer, true);
+
+    // The next guarded buffer gets the released reservation back, zeroed.
+    buffer = wasm::NewArrayBuffer(isolate, size, true);
+    CHECK(!buffer.is_null());
+    CHECK_EQ(allocation_base, buffer->allocation_base());
+    CHECK_EQ(0, reinterpret_cast<byte*>(buffer->backing_store())[size - 1]);
+    wasm::DetachMemoryBuffer(isolate, buffer, true);
+  }
+  Cleanup();
+}
+#endif  // V8_TRAP_HANDLER_SUPPORTED
+
+TEST(Run_WasmModule_SharedJSToWasmWrappers) {
+  {
+    FlagScope<bool> flag_scope(&FLAG_wasm_shared_wrapper_cache, true);
+    TestSignatures sigs;
+    Isolate* isolate = CcTest::InitIsolateOnce();
+    v8::internal::AccountingAllocator allocator;
+    Zone zone(&allocator, ZONE_NAME);
+
+    // Both modules export "main" with the same signature, so the second one
+    // reuses the wrapper of the first, patched to call its own code.
+    WasmModuleBuilder* builder = new (&zone) WasmModuleBuilder(&zone);
+    WasmFunctionBuilder* f = builder->AddFunction(sigs.i_v());
+    ExportAsMain(f);
+    byte code1[] = {WASM_I32V_1(11)};
+    EMIT_CODE_WITH_END(f, code1);
+    TestModule(&zone, builder, 11);
+    size_t num_templates = isolate->wasm_wrapper_templates()->size();
+    CHECK_LE(1, num_templates);
+
+    builder = new (&zone) WasmModuleBuilder(&zone);
+    f = builder->AddFunction(sigs.i_v());
+    ExportAsMain(f);
+    byte code2[] = {WASM_I32V_1(22)};
+    EMIT_CODE_WITH_END(f, code2);
+    TestModule(&zone, builder, 22);
+    CHECK_EQ(num_templates, isolate->wasm_wrapper_templates()->size());
+  }
+  Cleanup();
+}
+
 TEST(AtomicOpDisassembly) {
   {
     EXPERIMENTAL_FLAG_SCOPE(threads);
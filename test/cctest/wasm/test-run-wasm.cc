@@ -1703,6 +1703,66 @@ WASM_EXEC_TEST(StoreMem_offset_oob) {
   }
 }
 
+WASM_EXEC_TEST(MemoryCopy) {
+  EXPERIMENTAL_FLAG_SCOPE(bulk_memory);
+  WasmRunner<int32_t, uint32_t, uint32_t, uint32_t> r(execution_mode);
+  byte* memory = r.builder().AddMemoryElems<byte>(32);
+  BUILD(r,
+        WASM_MEMORY_COPY(WASM_GET_LOCAL(0), WASM_GET_LOCAL(1),
+                         WASM_GET_LOCAL(2)),
+        WASM_ZERO);
+
+  for (byte i = 0; i < 32; ++i) r.builder().WriteMemory(&memory[i], i);
+  CHECK_EQ(0, r.Call(16, 0, 8));
+  for (byte i = 0; i < 8; ++i) CHECK_EQ(i, memory[16 + i]);
+
+  // Overlapping ranges behave like memmove.
+  CHECK_EQ(0, r.Call(1, 0, 8));
+  CHECK_EQ(0, memory[1]);
+  CHECK_EQ(7, memory[8]);
+
+  // Empty copies at the end of memory are fine.
+  CHECK_EQ(0, r.Call(32, 32, 0));
+}
+
+WASM_EXEC_TEST(MemoryCopy_oob) {
+  EXPERIMENTAL_FLAG_SCOPE(bulk_memory);
+  WasmRunner<int32_t, uint32_t, uint32_t, uint32_t> r(execution_mode);
+  byte* memory = r.builder().AddMemoryElems<byte>(32);
+  BUILD(r,
+        WASM_MEMORY_COPY(WASM_GET_LOCAL(0), WASM_GET_LOCAL(1),
+                         WASM_GET_LOCAL(2)),
+        WASM_ZERO);
+
+  r.builder().WriteMemory(&memory[31], static_cast<byte>(42));
+  CHECK_TRAP(r.Call(28, 0, 8));
+  CHECK_TRAP(r.Call(0, 28, 8));
+  CHECK_TRAP(r.Call(0, 0, 33));
+  CHECK_TRAP(r.Call(0xfffffff0u, 0, 0x20));
+  // Nothing is written when the copy traps.
+  CHECK_EQ(42, memory[31]);
+}
+
+WASM_EXEC_TEST(MemoryFill) {
+  EXPERIMENTAL_FLAG_SCOPE(bulk_memory);
+  WasmRunner<int32_t, uint32_t, uint32_t, uint32_t> r(execution_mode);
+  byte* memory = r.builder().AddMemoryElems<byte>(32);
+  BUILD(r,
+        WASM_MEMORY_FILL(WASM_GET_LOCAL(0), WASM_GET_LOCAL(1),
+                         WASM_GET_LOCAL(2)),
+        WASM_ZERO);
+
+  // Only the low byte of the value is used.
+  CHECK_EQ(0, r.Call(4, 0x1ab, 8));
+  for (int i = 0; i < 32; ++i) {
+    CHECK_EQ(i >= 4 && i < 12 ? 0xab : 0, memory[i]);
+  }
+
+  CHECK_TRAP(r.Call(28, 1, 8));
+  CHECK_TRAP(r.Call(0xfffffff0u, 1, 0x20));
+  CHECK_EQ(0, memory[31]);
+}
+
 WASM_EXEC_TEST(LoadMemI32_P) {
   const int kNumElems = 8;
   WasmRunner<int32_t, int32_t> r(execution_mode);
@@ -2702,6 +2762,50 @@ WASM_EXEC_TEST(CallIndirect_EmptyTable) {
   CHECK_TRAP(r.Call(2));
 }
 
+// The bounds check of indirect calls reads the table size from the
+// WasmContext, so that the code does not need patching when the table grows.
+WASM_COMPILED_EXEC_TEST(CallIndirect_TableSizeFromContext) {
+  TestSignatures sigs;
+  WasmRunner<int32_t, int32_t> r(execution_mode);
+
+  WasmFunctionCompiler& t1 = r.NewFunction(sigs.i_ii());
+  BUILD(t1, WASM_I32_ADD(WASM_GET_LOCAL(0), WASM_GET_LOCAL(1)));
+  t1.SetSigIndex(1);
+
+  WasmFunctionCompiler& t2 = r.NewFunction(sigs.i_ii());
+  BUILD(t2, WASM_I32_SUB(WASM_GET_LOCAL(0), WASM_GET_LOCAL(1)));
+  t2.SetSigIndex(1);
+
+  // Signature table.
+  r.builder().AddSignature(sigs.f_ff());
+  r.builder().AddSignature(sigs.i_ii());
+
+  // Function table.
+  uint16_t indirect_function_table[] = {
+      static_cast<uint16_t>(t1.function_index()),
+      static_cast<uint16_t>(t2.function_index())};
+  r.builder().AddIndirectFunctionTable(indirect_function_table,
+                                       arraysize(indirect_function_table));
+  r.builder().PopulateIndirectFunctionTable();
+
+  // Build the caller function.
+  BUILD(r, WASM_CALL_INDIRECT2(1, WASM_GET_LOCAL(0), WASM_I32V_2(66),
+                               WASM_I32V_1(22)));
+
+  WasmContext* wasm_context =
+      r.builder().instance_object()->wasm_context()->get();
+  CHECK_EQ(2, wasm_context->function_table_size);
+  CHECK_EQ(44, r.Call(1));
+
+  // Shrinking the size in the context makes the second entry inaccessible.
+  wasm_context->function_table_size = 1;
+  CHECK_EQ(88, r.Call(0));
+  CHECK_TRAP(r.Call(1));
+
+  wasm_context->function_table_size = 2;
+  CHECK_EQ(44, r.Call(1));
+}
+
 WASM_EXEC_TEST(CallIndirect_canonical) {
   TestSignatures sigs;
   WasmRunner<int32_t, int32_t> r(execution_mode);
@@ -44,9 +44,15 @@ class MockPlatform final : public TestPlatform {
 
   void CallOnBackgroundThread(v8::Task* task,
                               ExpectedRuntime expected_runtime) override {
+    if (background_task_observer_) background_task_observer_();
     tasks_.push_back(task);
   }
 
+  // Sets a callback which is called whenever a background task is posted.
+  void SetBackgroundTaskObserver(std::function<void()> observer) {
+    background_task_observer_ = observer;
+  }
+
   bool IdleTasksEnabled(v8::Isolate* isolate) override { return false; }
 
   void ExecuteTasks() {
@@ -61,6 +67,7 @@ class MockPlatform final : public TestPlatform {
  private:
   // We do not execute tasks concurrently, so we only need one list of tasks.
   std::vector<Task*> tasks_;
+  std::function<void()> background_task_observer_;
   v8::Platform* old_platform_;
 };
 
@@ -228,6 +235,125 @@ STREAM_TEST(TestCutAfterOneFunctionCompilerFinishesFirst) {
   CHECK(tester.IsPromiseFulfilled());
 }
 
+// Create a valid module with {num_functions} functions.
+ZoneBuffer GetModuleWithManyFunctions(Zone* zone, int num_functions) {
+  ZoneBuffer buffer(zone);
+  TestSignatures sigs;
+  WasmModuleBuilder builder(zone);
+  for (int i = 0; i < num_functions; ++i) {
+    WasmFunctionBuilder* f = builder.AddFunction(sigs.i_iii());
+    uint8_t code[] = {kExprGetLocal,
+                      static_cast<uint8_t>(i % 3),
+                      kExprGetLocal,
+                      static_cast<uint8_t>((i + 1) % 3),
+                      kExprI32Add,
+                      kExprEnd};
+    f->EmitCode(code, arraysize(code));
+  }
+  builder.WriteTo(buffer);
+  return buffer;
+}
+
+// Feed {buffer} to the stream in chunks of varying size, as they would arrive
+// over the network. Compiler tasks run after every {tasks_interval} chunks,
+// which simulates the time that passes between two chunks.
+void StreamInChunks(StreamTester* tester, const ZoneBuffer& buffer,
+                    int tasks_interval) {
+  static const size_t kChunkSizes[] = {1, 7, 13, 64, 3, 200, 31};
+  size_t offset = 0;
+  for (int chunk = 0; offset < buffer.size(); ++chunk) {
+    size_t size = std::min(kChunkSizes[chunk % arraysize(kChunkSizes)],
+                           buffer.size() - offset);
+    tester->OnBytesReceived(buffer.begin() + offset, size);
+    offset += size;
+    if ((chunk + 1) % tasks_interval == 0) tester->RunCompilerTasks();
+  }
+}
+
+// Test a module with many functions that arrives in small chunks, with
+// compilation running between the chunks.
+STREAM_TEST(TestManyFunctionsInSmallChunks) {
+  StreamTester tester;
+  ZoneBuffer buffer = GetModuleWithManyFunctions(tester.zone(), 100);
+
+  StreamInChunks(&tester, buffer, 2);
+  CHECK(tester.IsPromisePending());
+  tester.FinishStream();
+  tester.RunCompilerTasks();
+  CHECK(tester.IsPromiseFulfilled());
+}
+
+// Test a module with many functions that arrives in small chunks, but all
+// compilation happens after the stream finished.
+STREAM_TEST(TestManyFunctionsInSmallChunksStreamFinishesFirst) {
+  StreamTester tester;
+  ZoneBuffer buffer = GetModuleWithManyFunctions(tester.zone(), 100);
+
+  StreamInChunks(&tester, buffer, std::numeric_limits<int>::max());
+  tester.FinishStream();
+  tester.RunCompilerTasks();
+  CHECK(tester.IsPromiseFulfilled());
+}
+
+// Test a single chunk which contains more function bodies than the streaming
+// processor buffers before it hands them to the background tasks.
+STREAM_TEST(TestManyFunctionsInOneChunk) {
+  StreamTester tester;
+  ZoneBuffer buffer = GetModuleWithManyFunctions(tester.zone(), 100);
+
+  tester.OnBytesReceived(buffer.begin(), buffer.size());
+  tester.RunCompilerTasks();
+  CHECK(tester.IsPromisePending());
+  tester.FinishStream();
+  tester.RunCompilerTasks();
+  CHECK(tester.IsPromiseFulfilled());
+}
+
+int streamed_units_committed = 0;
+
+int* LookupStreamedUnitsCommitted(const char* name) {
+  return strcmp(name, "c:V8.WasmStreamedUnitsCommitted") == 0
+             ? &streamed_units_committed
+             : nullptr;
+}
+
+// Test that function bodies are handed to the compilation tasks while the
+// chunk which contains them is still being processed, and before the code
+// section ends.
+STREAM_TEST(TestUnitsCommittedBeforeCodeSectionEnds) {
+  streamed_units_committed = 0;
+  CcTest::isolate()->SetCounterFunction(LookupStreamedUnitsCommitted);
+  MockPlatform* platform =
+      static_cast<MockPlatform*>(i::V8::GetCurrentPlatform());
+  int committed_at_first_task = -1;
+  platform->SetBackgroundTaskObserver([&committed_at_first_task]() {
+    if (committed_at_first_task < 0) {
+      committed_at_first_task = streamed_units_committed;
+    }
+  });
+
+  StreamTester tester;
+  ZoneBuffer buffer = GetModuleWithManyFunctions(tester.zone(), 100);
+
+  // The code section is the last section, so this cuts the last function body.
+  tester.OnBytesReceived(buffer.begin(), buffer.size() - 1);
+  CHECK_EQ(99, streamed_units_committed);
+  // The first compilation task was started for a part of the chunk only.
+  CHECK_LT(0, committed_at_first_task);
+  CHECK_GT(99, committed_at_first_task);
+
+  tester.RunCompilerTasks();
+  CHECK(tester.IsPromisePending());
+  tester.OnBytesReceived(buffer.end() - 1, 1);
+  tester.FinishStream();
+  tester.RunCompilerTasks();
+  CHECK_EQ(100, streamed_units_committed);
+  CHECK(tester.IsPromiseFulfilled());
+
+  platform->SetBackgroundTaskObserver(nullptr);
+  CcTest::isolate()->SetCounterFunction(nullptr);
+}
+
 // Create a module with an invalid global section.
 ZoneBuffer GetModuleWithInvalidSection(Zone* zone) {
   ZoneBuffer buffer(zone);
@@ -140,6 +140,10 @@ void TestingModuleBuilder::AddIndirectFunctionTable(uint16_t* function_indexes,
   for (uint32_t i = 0; i < table_size; ++i) {
     table.values.push_back(function_indexes[i]);
   }
+  // Indirect calls load the size of the first table from the WasmContext.
+  if (test_module_.function_tables.size() == 1) {
+    instance_object_->wasm_context()->get()->function_table_size = table_size;
+  }
 
   function_tables_.push_back(
       isolate_->global_handles()
@@ -607,4 +607,13 @@ inline WasmOpcode LoadStoreOpcodeOf(MachineType type, bool store) {
   x, y, WASM_ATOMICS_OP(op),                            \
       static_cast<byte>(ElementSizeLog2Of(representation)), ZERO_OFFSET
 
+//------------------------------------------------------------------------------
+// Bulk memory operations.
+//------------------------------------------------------------------------------
+#define WASM_NUMERIC_OP(op) kNumericPrefix, static_cast<byte>(op)
+#define WASM_MEMORY_COPY(dst, src, size) \
+  dst, src, size, WASM_NUMERIC_OP(kExprMemoryCopy), 0
+#define WASM_MEMORY_FILL(dst, value, size) \
+  dst, value, size, WASM_NUMERIC_OP(kExprMemoryFill), 0
+
 #endif  // V8_WASM_MACRO_GEN_H_
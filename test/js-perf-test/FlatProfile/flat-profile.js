@@ -0,0 +1,71 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('FlatProfile', [1000], [
+  new Benchmark('FlatProfile', false, false, 0,
+    FlatProfile, FlatProfileSetup, FlatProfileTearDown)
+]);
+
+new BenchmarkSuite('FlatProfileCompile', [1000], [
+  new Benchmark('FlatProfileCompile', false, false, 0,
+    FlatProfileCompile, FlatProfileCompileSetup, FlatProfileTearDown)
+]);
+
+// ----------------------------------------------------------------------------
+
+// Many distinct functions which each do a little work. None of them gets hot
+// enough to be optimized, so most of the time is spent in the interpreter.
+// Compare runs with and without --no-opt to see how much of the score the
+// optimizing compiler still contributes.
+
+var kNumFunctions = 500;
+var kNumCompiledFunctions = 20;
+
+var functions;
+var result;
+var serial = 0;
+
+function MakeFunction(id) {
+  // Each function has a distinct source, so that it gets its own
+  // SharedFunctionInfo and is not served from the compilation cache.
+  return new Function('o', 'n',
+      'var sum = ' + id + ';' +
+      'for (var i = 0; i < n; i++) {' +
+      '  sum += o.x * i + o.y;' +
+      '  o.x = (o.x + 1) | 0;' +
+      '}' +
+      'return sum | 0;');
+}
+
+function FlatProfileSetup() {
+  functions = [];
+  for (var i = 0; i < kNumFunctions; i++) {
+    functions.push(MakeFunction(serial++));
+  }
+  result = 0;
+}
+
+function FlatProfile() {
+  var o = {x: 1, y: 2};
+  for (var i = 0; i < kNumFunctions; i++) {
+    result = (result + functions[i](o, 10)) | 0;
+  }
+}
+
+function FlatProfileCompileSetup() {
+  result = 0;
+}
+
+// Measures the cost of getting new functions to run at all: parsing, bytecode
+// generation and a first call.
+function FlatProfileCompile() {
+  var o = {x: 1, y: 2};
+  for (var i = 0; i < kNumCompiledFunctions; i++) {
+    result = (result + MakeFunction(serial++)(o, 10)) | 0;
+  }
+}
+
+function FlatProfileTearDown() {
+  return typeof result === 'number';
+}
@@ -0,0 +1,112 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('ManySites', [1000], [
+  new Benchmark('ManySites', false, false, 0,
+                ManySites, Setup, ManySitesTearDown),
+]);
+
+new BenchmarkSuite('Polymorphic', [1000], [
+  new Benchmark('Polymorphic', false, false, 0,
+                Polymorphic, Setup, PolymorphicTearDown),
+]);
+
+var result;
+var values;
+
+function Setup() {
+  result = undefined;
+  values = [];
+  for (var i = 0; i < 100; ++i) values.push(i);
+}
+
+// ----------------------------------------------------------------------------
+// A caller with a rarely taken call to a big function, followed by hot calls
+// to medium sized helpers. Inlining in visitation order spends most of the
+// cumulative budget on the cold, big callee.
+
+function Big(x) {
+  var r = x;
+  r = (r * 31 + 7) % 1009; r = (r * 17 + 3) % 1013;
+  r = (r * 13 + 5) % 1019; r = (r * 11 + 1) % 1021;
+  r = (r * 31 + 7) % 1009; r = (r * 17 + 3) % 1013;
+  r = (r * 13 + 5) % 1019; r = (r * 11 + 1) % 1021;
+  r = (r * 31 + 7) % 1009; r = (r * 17 + 3) % 1013;
+  r = (r * 13 + 5) % 1019; r = (r * 11 + 1) % 1021;
+  r = (r * 31 + 7) % 1009; r = (r * 17 + 3) % 1013;
+  r = (r * 13 + 5) % 1019; r = (r * 11 + 1) % 1021;
+  r = (r * 31 + 7) % 1009; r = (r * 17 + 3) % 1013;
+  r = (r * 13 + 5) % 1019; r = (r * 11 + 1) % 1021;
+  return r;
+}
+
+function Helper1(x) {
+  var a = x + 1, b = x - 1;
+  if (a > b) return (a * b) | 0;
+  return (a + b) | 0;
+}
+
+function Helper2(x) {
+  var a = x * 2, b = x >> 1;
+  if (a > b) return (a - b) | 0;
+  return (a ^ b) | 0;
+}
+
+function Helper3(x) {
+  var a = x | 3, b = x & 3;
+  if (a > b) return (a + b) | 0;
+  return (a - b) | 0;
+}
+
+function Caller(x) {
+  var r = 0;
+  if (x === 99) r += Big(x);
+  r += Helper1(x);
+  r += Helper2(x);
+  r += Helper3(x);
+  return r;
+}
+
+function ManySites() {
+  var r = 0;
+  for (var i = 0; i < values.length; ++i) r += Caller(values[i]);
+  result = r;
+}
+
+function ManySitesTearDown() {
+  var expected = 0;
+  for (var i = 0; i < 100; ++i) expected += Caller(i);
+  return result === expected;
+}
+
+// ----------------------------------------------------------------------------
+// A polymorphic call site whose targets are dispatched by type.
+
+function Circle(r) { this.r = r; }
+Circle.prototype.area = function() { return 3 * this.r * this.r; };
+
+function Square(s) { this.s = s; }
+Square.prototype.area = function() { return this.s * this.s; };
+
+function Rect(w, h) { this.w = w; this.h = h; }
+Rect.prototype.area = function() { return this.w * this.h; };
+
+var shapes = [];
+for (var i = 0; i < 99; ++i) {
+  if (i % 3 == 0) shapes.push(new Circle(i));
+  else if (i % 3 == 1) shapes.push(new Square(i));
+  else shapes.push(new Rect(i, 2));
+}
+
+function Polymorphic() {
+  var r = 0;
+  for (var i = 0; i < shapes.length; ++i) r += shapes[i].area();
+  result = r;
+}
+
+function PolymorphicTearDown() {
+  var expected = 0;
+  for (var i = 0; i < shapes.length; ++i) expected += shapes[i].area();
+  return result === expected;
+}
@@ -0,0 +1,45 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --validate-asm --concurrent-asm-translation --allow-natives-syntax
+
+(function TestValidModule() {
+  function Module(stdlib, foreign, heap) {
+    "use asm";
+    function f(a) {
+      a = a | 0;
+      return (a + 1) | 0;
+    }
+    return { f: f };
+  }
+  var m = Module(this);
+  assertTrue(%IsAsmWasmCode(Module));
+  assertEquals(42, m.f(41));
+})();
+
+(function TestEagerValidModule() {
+  var m = (function Module(stdlib, foreign, heap) {
+    "use asm";
+    function f(a) {
+      a = +a;
+      return +(a * 2.0);
+    }
+    return { f: f };
+  })(this);
+  assertEquals(5, m.f(2.5));
+})();
+
+(function TestInvalidModuleFallsBack() {
+  function Module() {
+    "use asm";
+    function f(a) {
+      // Missing parameter type annotation.
+      return a;
+    }
+    return { f: f };
+  }
+  var m = Module();
+  assertFalse(%IsAsmWasmCode(Module));
+  assertEquals("x", m.f("x"));
+})();
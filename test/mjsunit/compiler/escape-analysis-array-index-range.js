@@ -0,0 +1,91 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-escape
+
+// Loads from a non-escaping array with an index of small known range.
+
+(function TestPairInLoop() {
+  function foo(x, y) {
+    var sum = 0;
+    for (var i = 0; i < 10; ++i) {
+      var pair = [x, y];
+      sum += pair[i & 1];
+    }
+    return sum;
+  }
+  assertEquals(25, foo(2, 3));
+  assertEquals(25, foo(2, 3));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(25, foo(2, 3));
+  assertEquals(55, foo(5, 6));
+})();
+
+(function TestTriple() {
+  function foo(a, b, c, i) {
+    var triple = [a, b, c];
+    return triple[i % 3];
+  }
+  assertEquals("b", foo("a", "b", "c", 1));
+  assertEquals("c", foo("a", "b", "c", 2));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals("a", foo("a", "b", "c", 0));
+  assertEquals("b", foo("a", "b", "c", 1));
+  assertEquals("c", foo("a", "b", "c", 2));
+})();
+
+(function TestUpdatedInLoop() {
+  function foo(n) {
+    var pair = [0, 1];
+    var result = 0;
+    for (var i = 0; i < n; ++i) {
+      pair[0] = pair[0] + 1;
+      result += pair[i & 1];
+    }
+    return result;
+  }
+  assertEquals(11, foo(5));
+  assertEquals(11, foo(5));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(11, foo(5));
+  assertEquals(19, foo(7));
+})();
+
+(function TestObjectElements() {
+  function foo(i) {
+    var a = {x: 1};
+    var b = {x: 2};
+    var pair = [a, b];
+    var o = pair[i & 1];
+    return o.x;
+  }
+  assertEquals(1, foo(0));
+  assertEquals(2, foo(1));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(1, foo(0));
+  assertEquals(2, foo(1));
+})();
+
+(function TestNegativeIndex() {
+  function foo(x, y, i) {
+    var pair = [x, y];
+    return pair[(i & 1) - 1];
+  }
+  assertEquals(undefined, foo(2, 3, 0));
+  assertEquals(2, foo(2, 3, 1));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(undefined, foo(2, 3, 0));
+  assertEquals(2, foo(2, 3, 1));
+})();
+
+(function TestNegativeConstantIndex() {
+  function foo(x, y) {
+    var pair = [x, y];
+    return pair[-1];
+  }
+  assertEquals(undefined, foo(2, 3));
+  assertEquals(undefined, foo(2, 3));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(undefined, foo(2, 3));
+})();
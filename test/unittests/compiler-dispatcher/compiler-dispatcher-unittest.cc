@@ -20,6 +20,7 @@
 #include "src/parsing/parse-info.h"
 #include "src/parsing/parsing.h"
 #include "src/v8.h"
+#include "test/common/wasm/flag-utils.h"
 #include "test/unittests/test-helpers.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -929,6 +930,83 @@ TEST_F(CompilerDispatcherTest, EnqueueAndStep) {
   platform.ClearBackgroundTasks();
 }
 
+TEST_F(CompilerDispatcherTest, EnqueuePredictedIdleTask) {
+  MockPlatform platform;
+  CompilerDispatcher dispatcher(i_isolate(), &platform, FLAG_stack_size);
+
+  const char script[] = TEST_SCRIPT();
+  Handle<JSFunction> f =
+      Handle<JSFunction>::cast(test::RunJS(isolate(), script));
+  Handle<SharedFunctionInfo> shared(f->shared(), i_isolate());
+
+  ASSERT_TRUE(dispatcher.EnqueuePredicted(shared));
+  ASSERT_TRUE(dispatcher.IsEnqueued(shared));
+  ASSERT_EQ(UnoptimizedCompileJob::Status::kReadyToParse,
+            GetUnoptimizedJobStatus(dispatcher.jobs_.begin()->second));
+  ASSERT_EQ(1u, dispatcher.num_predicted_jobs_);
+
+  // Finish the job during idle time, before anybody asked for the function.
+  ASSERT_TRUE(platform.IdleTaskPending());
+  platform.RunIdleTask(1000.0, 0.0);
+
+  ASSERT_FALSE(dispatcher.IsEnqueued(shared));
+  ASSERT_TRUE(shared->is_compiled());
+  ASSERT_EQ(1u, dispatcher.num_predicted_ready_);
+  ASSERT_EQ(0u, dispatcher.num_predicted_on_demand_);
+  ASSERT_EQ(0u, dispatcher.num_predicted_wasted_);
+  ASSERT_TRUE(platform.BackgroundTasksPending());
+  platform.ClearBackgroundTasks();
+}
+
+TEST_F(CompilerDispatcherTest, EnqueuePredictedFinishNow) {
+  MockPlatform platform;
+  CompilerDispatcher dispatcher(i_isolate(), &platform, FLAG_stack_size);
+
+  const char script[] = TEST_SCRIPT();
+  Handle<JSFunction> f =
+      Handle<JSFunction>::cast(test::RunJS(isolate(), script));
+  Handle<SharedFunctionInfo> shared(f->shared(), i_isolate());
+
+  ASSERT_TRUE(dispatcher.EnqueuePredicted(shared));
+  ASSERT_TRUE(dispatcher.FinishNow(shared));
+  ASSERT_FALSE(dispatcher.IsEnqueued(shared));
+  ASSERT_TRUE(shared->is_compiled());
+
+  // The function was needed before the dispatcher got to it.
+  ASSERT_EQ(1u, dispatcher.num_predicted_jobs_);
+  ASSERT_EQ(0u, dispatcher.num_predicted_ready_);
+  ASSERT_EQ(1u, dispatcher.num_predicted_on_demand_);
+  ASSERT_EQ(0u, dispatcher.num_predicted_wasted_);
+  platform.ClearIdleTask();
+  platform.ClearBackgroundTasks();
+}
+
+TEST_F(CompilerDispatcherTest, EnqueuePredictedAbortAll) {
+  MockPlatform platform;
+  CompilerDispatcher dispatcher(i_isolate(), &platform, FLAG_stack_size);
+
+  const char script[] = TEST_SCRIPT();
+  Handle<JSFunction> f =
+      Handle<JSFunction>::cast(test::RunJS(isolate(), script));
+  Handle<SharedFunctionInfo> shared(f->shared(), i_isolate());
+
+  // Regular jobs are not accounted as predictions.
+  ASSERT_TRUE(dispatcher.Enqueue(shared));
+  ASSERT_TRUE(dispatcher.EnqueuePredicted(shared));
+  ASSERT_EQ(0u, dispatcher.num_predicted_jobs_);
+  dispatcher.AbortAll(CompilerDispatcher::BlockingBehavior::kBlock);
+  ASSERT_EQ(0u, dispatcher.num_predicted_wasted_);
+
+  ASSERT_TRUE(dispatcher.EnqueuePredicted(shared));
+  dispatcher.AbortAll(CompilerDispatcher::BlockingBehavior::kBlock);
+  ASSERT_FALSE(dispatcher.IsEnqueued(shared));
+  ASSERT_FALSE(shared->is_compiled());
+  ASSERT_EQ(1u, dispatcher.num_predicted_jobs_);
+  ASSERT_EQ(1u, dispatcher.num_predicted_wasted_);
+  platform.ClearIdleTask();
+  platform.ClearBackgroundTasks();
+}
+
 TEST_F(CompilerDispatcherTest, CompileLazyFinishesDispatcherJob) {
   // Use the real dispatcher so that CompileLazy checks the same one for
   // enqueued functions.
@@ -1065,5 +1143,98 @@ TEST_F(CompilerDispatcherTest, CompileMultipleOnBackgroundThread) {
   ASSERT_FALSE(platform.IdleTaskPending());
 }
 
+TEST_F(CompilerDispatcherTest, CompileAsmJsOnBackgroundThread) {
+  MockPlatform platform;
+  CompilerDispatcher dispatcher(i_isolate(), &platform, FLAG_stack_size);
+
+  const char script[] =
+      "function asm1(stdlib) {"
+      "  'use asm';"
+      "  function f() { return 42; }"
+      "  return { f: f };"
+      "}"
+      "asm1;";
+  Handle<JSFunction> f =
+      Handle<JSFunction>::cast(test::RunJS(isolate(), script));
+  Handle<SharedFunctionInfo> shared(f->shared(), i_isolate());
+
+  ASSERT_TRUE(dispatcher.Enqueue(shared));
+  dispatcher.tracer_->RecordCompile(50000.0);
+  platform.RunIdleTask(10.0, 0.0);
+  ASSERT_EQ(UnoptimizedCompileJob::Status::kReadyToCompile,
+            GetUnoptimizedJobStatus(dispatcher.jobs_.begin()->second));
+  ASSERT_TRUE(platform.BackgroundTasksPending());
+
+  // Validation and translation happen on the background thread.
+  platform.RunBackgroundTasksAndBlock(V8::GetCurrentPlatform());
+  ASSERT_EQ(UnoptimizedCompileJob::Status::kCompiled,
+            GetUnoptimizedJobStatus(dispatcher.jobs_.begin()->second));
+  ASSERT_FALSE(shared->is_compiled());
+
+  platform.RunIdleTask(1000.0, 0.0);
+  ASSERT_FALSE(dispatcher.IsEnqueued(shared));
+  ASSERT_TRUE(shared->is_compiled());
+  ASSERT_TRUE(shared->HasAsmWasmData());
+  ASSERT_FALSE(platform.IdleTaskPending());
+}
+
+TEST_F(CompilerDispatcherTest, CompileInvalidAsmJsOnBackgroundThread) {
+  MockPlatform platform;
+  CompilerDispatcher dispatcher(i_isolate(), &platform, FLAG_stack_size);
+
+  const char script[] =
+      "function asm2(stdlib) {"
+      "  'use asm';"
+      "  function f() { return stdlib; }"
+      "  return { f: f };"
+      "}"
+      "asm2;";
+  Handle<JSFunction> f =
+      Handle<JSFunction>::cast(test::RunJS(isolate(), script));
+  Handle<SharedFunctionInfo> shared(f->shared(), i_isolate());
+
+  ASSERT_TRUE(dispatcher.Enqueue(shared));
+  dispatcher.tracer_->RecordCompile(50000.0);
+  platform.RunIdleTask(10.0, 0.0);
+  ASSERT_TRUE(platform.BackgroundTasksPending());
+  platform.RunBackgroundTasksAndBlock(V8::GetCurrentPlatform());
+  ASSERT_EQ(UnoptimizedCompileJob::Status::kCompiled,
+            GetUnoptimizedJobStatus(dispatcher.jobs_.begin()->second));
+
+  // The failed asm.js job is replaced by bytecode when it is finalized.
+  platform.RunIdleTask(1000.0, 0.0);
+  ASSERT_FALSE(dispatcher.IsEnqueued(shared));
+  ASSERT_TRUE(shared->is_compiled());
+  ASSERT_FALSE(shared->HasAsmWasmData());
+  ASSERT_TRUE(shared->HasBytecodeArray());
+  ASSERT_FALSE(i_isolate()->has_pending_exception());
+  ASSERT_FALSE(platform.IdleTaskPending());
+}
+
+TEST_F(CompilerDispatcherTest, ConcurrentAsmTranslationEnqueuesModules) {
+  // Use the real dispatcher, which is the one asm.js modules are handed to.
+  CompilerDispatcher* dispatcher = i_isolate()->compiler_dispatcher();
+  FLAG_SCOPE(concurrent_asm_translation);
+
+  // The module is eagerly compiled as part of the script, which leaves it to
+  // the dispatcher instead.
+  const char script[] =
+      "(function asm3(stdlib) {"
+      "  'use asm';"
+      "  function f() { return 42; }"
+      "  return { f: f };"
+      "});";
+  Handle<JSFunction> f =
+      Handle<JSFunction>::cast(test::RunJS(isolate(), script));
+  Handle<SharedFunctionInfo> shared(f->shared(), i_isolate());
+
+  ASSERT_TRUE(dispatcher->IsEnqueued(shared));
+  ASSERT_FALSE(shared->is_compiled());
+
+  ASSERT_TRUE(dispatcher->FinishNow(shared));
+  ASSERT_FALSE(dispatcher->IsEnqueued(shared));
+  ASSERT_TRUE(shared->HasAsmWasmData());
+}
+
 }  // namespace internal
 }  // namespace v8
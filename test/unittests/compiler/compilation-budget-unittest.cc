@@ -0,0 +1,71 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/compilation-budget.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+namespace {
+
+base::TimeDelta Milliseconds(int ms) {
+  return base::TimeDelta::FromMilliseconds(ms);
+}
+
+}  // namespace
+
+TEST(CompilationBudgetTest, UnlimitedNeverDegrades) {
+  CompilationBudget budget(0, 0, base::TimeDelta());
+  budget.Update(1000000, 1000000000, Milliseconds(100000));
+  EXPECT_EQ(0, budget.UsagePercent());
+  EXPECT_FALSE(budget.Degrade(CompilationBudget::kInliningDisabled));
+  EXPECT_FALSE(budget.Degrade(CompilationBudget::kAborted));
+}
+
+TEST(CompilationBudgetTest, UsageIsMostExhaustedResource) {
+  CompilationBudget budget(1000, 1000, Milliseconds(1000));
+  budget.Update(100, 300, Milliseconds(200));
+  EXPECT_EQ(30, budget.UsagePercent());
+  budget.Update(100, 300, Milliseconds(700));
+  EXPECT_EQ(70, budget.UsagePercent());
+}
+
+TEST(CompilationBudgetTest, DegradesGradually) {
+  CompilationBudget budget(1000, 0, base::TimeDelta());
+
+  budget.Update(400, 0, base::TimeDelta());
+  EXPECT_FALSE(budget.Degrade(CompilationBudget::kInliningDisabled));
+
+  budget.Update(600, 0, base::TimeDelta());
+  EXPECT_TRUE(budget.Degrade(CompilationBudget::kInliningDisabled));
+  EXPECT_FALSE(budget.Degrade(CompilationBudget::kLoadEliminationSkipped));
+
+  budget.Update(1500, 0, base::TimeDelta());
+  EXPECT_TRUE(budget.Degrade(CompilationBudget::kLoadEliminationSkipped));
+  EXPECT_TRUE(budget.Degrade(CompilationBudget::kEscapeAnalysisSkipped));
+  EXPECT_FALSE(budget.Degrade(CompilationBudget::kAborted));
+
+  budget.Update(2000, 0, base::TimeDelta());
+  EXPECT_TRUE(budget.Degrade(CompilationBudget::kAborted));
+
+  EXPECT_TRUE(budget.HasDegradation(CompilationBudget::kInliningDisabled));
+  EXPECT_TRUE(
+      budget.HasDegradation(CompilationBudget::kLoadEliminationSkipped));
+  EXPECT_TRUE(budget.HasDegradation(CompilationBudget::kEscapeAnalysisSkipped));
+  EXPECT_TRUE(budget.HasDegradation(CompilationBudget::kAborted));
+}
+
+TEST(CompilationBudgetTest, NoDegradationRecordedBelowThreshold) {
+  CompilationBudget budget(0, 1000, base::TimeDelta());
+  budget.Update(0, 999, base::TimeDelta());
+  EXPECT_FALSE(budget.Degrade(CompilationBudget::kEscapeAnalysisSkipped));
+  EXPECT_FALSE(
+      budget.HasDegradation(CompilationBudget::kEscapeAnalysisSkipped));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
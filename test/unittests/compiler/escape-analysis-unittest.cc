@@ -0,0 +1,132 @@
+// Copyright 2017 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/escape-analysis.h"
+#include "src/compiler/access-builder.h"
+#include "src/compiler/escape-analysis-reducer.h"
+#include "src/compiler/graph-reducer.h"
+#include "src/compiler/js-graph.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
+#include "test/unittests/compiler/graph-unittest.h"
+#include "test/unittests/compiler/node-test-utils.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class EscapeAnalysisTest : public TypedGraphTest {
+ public:
+  EscapeAnalysisTest()
+      : TypedGraphTest(3),
+        simplified_(zone()),
+        jsgraph_(isolate(), graph(), common(), nullptr, simplified(), nullptr) {
+  }
+  ~EscapeAnalysisTest() override {}
+
+ protected:
+  // Builds {array = [value0, value1]; return array[index]} with an {index} of
+  // type {index_type}, then runs escape analysis and its reducer on it.
+  void BuildAndReduceLoadFromPair(Type* index_type) {
+    Node* control = graph()->start();
+    Node* effect = graph()->start();
+    index_ = Parameter(index_type, 0);
+    value0_ = Parameter(Type::Any(), 1);
+    value1_ = Parameter(Type::Any(), 2);
+    ElementAccess const access = AccessBuilder::ForFixedArrayElement();
+
+    effect = graph()->NewNode(
+        common()->BeginRegion(RegionObservability::kNotObservable), effect);
+    allocate_ = effect = graph()->NewNode(
+        simplified()->Allocate(Type::OtherInternal()),
+        NumberConstant(FixedArray::SizeFor(2)), effect, control);
+    NodeProperties::SetType(allocate_, Type::OtherInternal());
+    effect = graph()->NewNode(simplified()->StoreElement(access), allocate_,
+                              TypedNumberConstant(0), value0_, effect, control);
+    effect = graph()->NewNode(simplified()->StoreElement(access), allocate_,
+                              TypedNumberConstant(1), value1_, effect, control);
+    Node* array = effect =
+        graph()->NewNode(common()->FinishRegion(), allocate_, effect);
+    NodeProperties::SetType(array, Type::OtherInternal());
+    load_ = effect = graph()->NewNode(simplified()->LoadElement(access), array,
+                                      index_, effect, control);
+    NodeProperties::SetType(load_, Type::Any());
+    return_ = graph()->NewNode(common()->Return(), Int32Constant(0), load_,
+                               effect, control);
+    graph()->SetEnd(graph()->NewNode(common()->End(1), return_));
+
+    EscapeAnalysis escape_analysis(jsgraph(), zone());
+    escape_analysis.ReduceGraph();
+    GraphReducer graph_reducer(zone(), graph(), jsgraph()->Dead());
+    EscapeAnalysisReducer escape_reducer(&graph_reducer, jsgraph(),
+                                         escape_analysis.analysis_result(),
+                                         zone());
+    graph_reducer.AddReducer(&escape_reducer);
+    graph_reducer.ReduceGraph();
+  }
+
+  Node* TypedNumberConstant(int value) {
+    Node* constant = NumberConstant(value);
+    NodeProperties::SetType(constant, Type::NewConstant(value, zone()));
+    return constant;
+  }
+
+  // Whether the allocation is still on the effect chain of the return.
+  bool AllocationIsLive() {
+    Node* effect = NodeProperties::GetEffectInput(return_);
+    while (effect->opcode() != IrOpcode::kStart) {
+      if (effect == allocate_) return true;
+      effect = NodeProperties::GetEffectInput(effect);
+    }
+    return false;
+  }
+
+  Node* returned_value() { return NodeProperties::GetValueInput(return_, 1); }
+
+  JSGraph* jsgraph() { return &jsgraph_; }
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+
+  Node* index_ = nullptr;
+  Node* value0_ = nullptr;
+  Node* value1_ = nullptr;
+  Node* allocate_ = nullptr;
+  Node* load_ = nullptr;
+  Node* return_ = nullptr;
+
+ private:
+  SimplifiedOperatorBuilder simplified_;
+  JSGraph jsgraph_;
+};
+
+TEST_F(EscapeAnalysisTest, LoadElementWithSmallIndexRange) {
+  BuildAndReduceLoadFromPair(Type::Range(0, 1, zone()));
+  EXPECT_THAT(returned_value(),
+              IsSelect(MachineRepresentation::kTagged,
+                       IsNumberEqual(index_, IsNumberConstant(0)), value0_,
+                       value1_));
+  EXPECT_FALSE(AllocationIsLive());
+}
+
+TEST_F(EscapeAnalysisTest, LoadElementWithSingletonIndexRange) {
+  BuildAndReduceLoadFromPair(Type::Range(1, 1, zone()));
+  EXPECT_EQ(value1_, returned_value());
+  EXPECT_FALSE(AllocationIsLive());
+}
+
+TEST_F(EscapeAnalysisTest, LoadElementWithNegativeIndexRange) {
+  // Negative offsets would alias the map and length fields.
+  BuildAndReduceLoadFromPair(Type::Range(-1, 0, zone()));
+  EXPECT_EQ(load_, returned_value());
+  EXPECT_TRUE(AllocationIsLive());
+}
+
+TEST_F(EscapeAnalysisTest, LoadElementWithOutOfBoundsIndexRange) {
+  BuildAndReduceLoadFromPair(Type::Range(1, 2, zone()));
+  EXPECT_EQ(load_, returned_value());
+  EXPECT_TRUE(AllocationIsLive());
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
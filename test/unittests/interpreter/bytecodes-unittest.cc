@@ -319,6 +319,21 @@ TEST(Bytecodes, IsJumpIfToBoolean) {
 #undef TEST_BYTECODE
 }
 
+TEST(Bytecodes, StarLookaheadBytecodesWriteAccumulator) {
+  // The inlined Star stores the accumulator, so it only makes sense after
+  // bytecodes that produce one and fall through to the next bytecode.
+#define TEST_BYTECODE(Name, ...)                                             \
+  if (Bytecodes::IsStarLookahead(Bytecode::k##Name, OperandScale::kSingle)) { \
+    EXPECT_TRUE(Bytecodes::WritesAccumulator(Bytecode::k##Name));            \
+    EXPECT_FALSE(Bytecodes::IsJumpOrReturn(Bytecode::k##Name));              \
+  }                                                                          \
+  EXPECT_FALSE(                                                              \
+      Bytecodes::IsStarLookahead(Bytecode::k##Name, OperandScale::kDouble));
+
+  BYTECODE_LIST(TEST_BYTECODE)
+#undef TEST_BYTECODE
+}
+
 #undef OR_IS_BYTECODE
 #undef IN_BYTECODE_LIST
 
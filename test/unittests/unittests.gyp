@@ -48,12 +48,14 @@
       "compiler/code-assembler-unittest.h",
       'compiler/common-operator-reducer-unittest.cc',
       'compiler/common-operator-unittest.cc',
+      'compiler/compilation-budget-unittest.cc',
       'compiler/compiler-test-utils.h',
       'compiler/control-equivalence-unittest.cc',
       'compiler/control-flow-optimizer-unittest.cc',
       'compiler/dead-code-elimination-unittest.cc',
       'compiler/diamond-unittest.cc',
       'compiler/effect-control-linearizer-unittest.cc',
+      'compiler/escape-analysis-unittest.cc',
       'compiler/graph-reducer-unittest.cc',
       'compiler/graph-reducer-unittest.h',
       'compiler/graph-trimmer-unittest.cc',
@@ -0,0 +1,108 @@
+#!/usr/bin/env python
+#
+# Copyright 2017 the V8 project authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+
+"""Regenerates the perfect hash keyword table in src/parsing/scanner.cc.
+
+The scanner recognizes keywords by hashing the length, the first two and the
+last character of an identifier into a table with one slot per keyword. This
+script reads the KEYWORDS list from scanner.cc, searches for per-character
+hash values without collisions and rewrites the generated section between the
+BEGIN/END markers in place.
+
+Run it after changing the KEYWORDS list:
+
+  tools/gen-keywords-table.py [path/to/scanner.cc]
+"""
+
+import collections
+import os
+import random
+import re
+import sys
+
+TABLE_SIZE = 128
+MAX_ITERATIONS = 100000
+BEGIN_MARKER = "// BEGIN GENERATED KEYWORD TABLE"
+END_MARKER = "// END GENERATED KEYWORD TABLE"
+KEYWORD_RE = re.compile(r'KEYWORD\("([^"]+)", (Token::\w+)\)')
+
+
+def Hash(values, word):
+  h = len(word) + values[word[0]] + values[word[1]] + values[word[-1]]
+  return h & (TABLE_SIZE - 1)
+
+
+def Collisions(values, words):
+  buckets = collections.Counter(Hash(values, w) for w in words)
+  return sum(count - 1 for count in buckets.values())
+
+
+def FindHashValues(words):
+  chars = sorted(set(c for w in words for c in (w[0], w[1], w[-1])))
+  # Deterministic output for identical inputs.
+  for seed in range(1000):
+    rng = random.Random(seed)
+    values = collections.defaultdict(int)
+    for c in chars:
+      values[c] = rng.randrange(TABLE_SIZE)
+    cost = Collisions(values, words)
+    for _ in range(MAX_ITERATIONS):
+      if cost == 0:
+        return values
+      c = rng.choice(chars)
+      old = values[c]
+      values[c] = rng.randrange(TABLE_SIZE)
+      new_cost = Collisions(values, words)
+      if new_cost <= cost:
+        cost = new_cost
+      else:
+        values[c] = old
+  raise Exception("No perfect hash found, increase TABLE_SIZE")
+
+
+def Generate(keywords):
+  words = [k for k, _ in keywords]
+  values = FindHashValues(words)
+  lines = [BEGIN_MARKER]
+  lines.append("// Generated by tools/gen-keywords-table.py, do not edit.")
+  lines.append("static const int kKeywordTableSize = %d;" % TABLE_SIZE)
+  lines.append("")
+  lines.append("static const uint8_t kKeywordHashValues[128] = {")
+  for row in range(0, 128, 8):
+    entries = ", ".join("%3d" % values[chr(c)] for c in range(row, row + 8))
+    lines.append("    %s," % entries)
+  lines.append("};")
+  lines.append("")
+  slots = [None] * TABLE_SIZE
+  for word, token in keywords:
+    slots[Hash(values, word)] = (word, token)
+  lines.append("static const KeywordTableEntry kKeywordTable[] = {")
+  for slot in slots:
+    if slot is None:
+      lines.append('    {"", 0, Token::IDENTIFIER},')
+    else:
+      lines.append('    {"%s", %d, %s},' % (slot[0], len(slot[0]), slot[1]))
+  lines.append("};")
+  lines.append(END_MARKER)
+  return "\n".join(lines)
+
+
+def Main():
+  root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+  path = (sys.argv[1] if len(sys.argv) > 1
+          else os.path.join(root, "src", "parsing", "scanner.cc"))
+  with open(path) as f:
+    source = f.read()
+  keywords = KEYWORD_RE.findall(source)
+  begin = source.index(BEGIN_MARKER)
+  end = source.index(END_MARKER) + len(END_MARKER)
+  source = source[:begin] + Generate(keywords) + source[end:]
+  with open(path, "w") as f:
+    f.write(source)
+
+
+if __name__ == "__main__":
+  sys.exit(Main())
@@ -60,3 +60,20 @@ class BytecodeDispatchesReportTest(unittest.TestCase):
       ("a", 2, 0.2),
       ("c", 10, 0.1)
     ])
+
+  def test_merge_dispatches_tables(self):
+    merged = bdr.merge_dispatches_tables([
+      {"a": {"a": 1, "b": 2}},
+      {"a": {"b": 3}, "b": {"a": 4}}])
+    self.assertDictEqual(merged, {
+      "a": {"a": 1, "b": 5},
+      "b": {"a": 4}})
+
+  def test_find_fusion_candidates(self):
+    candidates = bdr.find_fusion_candidates({
+      "a": {"a": 10, "b": 30},
+      "b": {"a": 40, "c": 20}}, 2)
+    self.assertListEqual(candidates, [
+      ("b", "a", 40, 0.4, 40 / 60.0),
+      ("a", "b", 30, 0.3, 0.75)])
+    self.assertListEqual(bdr.find_fusion_candidates({}, 2), [])